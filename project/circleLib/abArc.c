@@ -0,0 +1,134 @@
+#include "shape.h"
+#include "_abCircle.h"
+
+/* abShapeKind's callback for arcs */
+static u_char
+arcKind(const AbShape *s)
+{
+  return ((const AbArc *)s)->check == abArcCheck ? SHAPE_KIND_SPANS : SHAPE_KIND_OTHER;
+}
+
+static void __attribute__((constructor))
+arcRegisterKind()
+{
+  abShapeKindRegister(arcKind);
+}
+
+#define COL_MIN (-32767)
+#define COL_MAX 32767
+
+// z-component of a x b; >= 0 when b is clockwise (on screen) from a
+static long
+cross(const Vec2 *a, int bCol, int bRow)
+{
+  return (long)a->axes[0] * bRow - (long)a->axes[1] * bCol;
+}
+
+// true if (col, row) relative to center lies within arc's sweep
+static int
+withinSweep(const AbArc *arc, int col, int row)
+{
+  int afterStart = cross(&arc->start, col, row) >= 0;
+  int beforeEnd = -cross(&arc->end, col, row) >= 0;
+  if (cross(&arc->start, arc->end.axes[0], arc->end.axes[1]) >= 0)
+    return afterStart && beforeEnd; /* sweep <= 180 degrees */
+  return afterStart || beforeEnd;
+}
+
+static long
+floorDiv(long n, long d)	/* d > 0 */
+{
+  long q = n / d;
+  if (n % d && n < 0)
+    q--;
+  return q;
+}
+
+static int
+clampCol(long col)
+{
+  return col < COL_MIN ? COL_MIN : (col > COL_MAX ? COL_MAX : col);
+}
+
+// cols (lo..hi) where k*col + m >= 0; lo > hi when there are none
+static void
+halfPlaneCols(long k, long m, Span *cols)
+{
+  cols->colMin = COL_MIN; cols->colMax = COL_MAX;
+  if (k > 0)
+    cols->colMin = clampCol(-floorDiv(m, k)); /* ceil(-m / k) */
+  else if (k < 0)
+    cols->colMax = clampCol(floorDiv(m, -k));
+  else if (m < 0)
+    cols->colMin = COL_MAX, cols->colMax = COL_MIN;
+}
+
+// true if pixel is in base shape and within arc's sweep
+int
+abArcCheck(const AbArc *arc, const Vec2 *centerPos, const Vec2 *pixel)
+{
+  const AbEllipse *base = arc->base;
+  if (!(*base->check)(base, centerPos, pixel))
+    return 0;
+  return withinSweep(arc, pixel->axes[0] - centerPos->axes[0],
+		     pixel->axes[1] - centerPos->axes[1]);
+}
+
+void
+abArcGetBounds(const AbArc *arc, const Vec2 *centerPos, Region *bounds)
+{
+  const AbEllipse *base = arc->base;
+  (*base->getBounds)(base, centerPos, bounds); /* conservative */
+}
+
+// base shape's spans clipped to the sweep's cols within row
+int
+abArcGetSpans(const AbArc *arc, const Vec2 *centerPos, int row, Span *spans)
+{
+  const AbEllipse *base = arc->base;
+  Span baseSpans[SHAPE_MAX_SPANS], sweep[2], afterStart, beforeEnd;
+  int center = centerPos->axes[0], relRow = row - centerPos->axes[1];
+  int numBase, numSweep, i, j, numSpans = 0;
+
+  numBase = (*base->getSpans)(base, centerPos, row, baseSpans);
+  if (!numBase)
+    return 0;
+
+  /* start: start.col*row - start.row*col >= 0;  end: col*end.row - row*end.col >= 0 */
+  halfPlaneCols(-arc->start.axes[1], (long)arc->start.axes[0] * relRow, &afterStart);
+  halfPlaneCols(arc->end.axes[1], -(long)arc->end.axes[0] * relRow, &beforeEnd);
+
+  if (cross(&arc->start, arc->end.axes[0], arc->end.axes[1]) >= 0) { /* intersection */
+    sweep[0].colMin = afterStart.colMin > beforeEnd.colMin ? afterStart.colMin : beforeEnd.colMin;
+    sweep[0].colMax = afterStart.colMax < beforeEnd.colMax ? afterStart.colMax : beforeEnd.colMax;
+    numSweep = 1;
+  } else {			/* union: sorted, merged if they touch */
+    if (afterStart.colMin <= beforeEnd.colMin)
+      sweep[0] = afterStart, sweep[1] = beforeEnd;
+    else
+      sweep[0] = beforeEnd, sweep[1] = afterStart;
+    numSweep = 2;
+    if (sweep[0].colMin > sweep[0].colMax) { /* first is empty */
+      sweep[0] = sweep[1];
+      numSweep = 1;
+    } else if (sweep[1].colMin <= sweep[0].colMax + 1) { /* overlap */
+      if (sweep[1].colMax > sweep[0].colMax)
+	sweep[0].colMax = sweep[1].colMax;
+      numSweep = 1;
+    }
+  }
+
+  for (i = 0; i < numBase; i++) {
+    int baseMin = baseSpans[i].colMin - center, baseMax = baseSpans[i].colMax - center;
+    for (j = 0; j < numSweep; j++) {
+      int lo = baseMin > sweep[j].colMin ? baseMin : sweep[j].colMin;
+      int hi = baseMax < sweep[j].colMax ? baseMax : sweep[j].colMax;
+      if (lo <= hi && numSpans < SHAPE_MAX_SPANS) {
+	spans[numSpans].colMin = center + lo;
+	spans[numSpans].colMax = center + hi;
+	numSpans++;
+      }
+    }
+  }
+  return numSpans;
+}
@@ -1,6 +1,23 @@
 #include "shape.h"
 #include "_abCircle.h"
 
+/* abShapeKind's callback for circles */
+static u_char
+circleKind(const AbShape *s)
+{
+  if (((const AbCircle *)s)->check == abCircleCheck)
+    return SHAPE_KIND_CIRCLE;
+  if (((const AbCircle *)s)->check == abCircleIncCheck)
+    return SHAPE_KIND_CIRCLE_INC;
+  return SHAPE_KIND_OTHER;
+}
+
+static void __attribute__((constructor))
+circleRegisterKind()
+{
+  abShapeKindRegister(circleKind);
+}
+
 // true if pixel is in circle centered at centerPos
 int abCircleCheck(const AbCircle *circle, const Vec2 *centerPos, const Vec2 *pixel)
 {
@@ -11,6 +28,13 @@ int abCircleCheck(const AbCircle *circle, const Vec2 *centerPos, const Vec2 *pix
   vec2Abs(&relPos);		      /* project to first quadrant */
   return (relPos.axes[0] <= radius && circle->chords[relPos.axes[0]] >= relPos.axes[1]);
 }
+
+// true if pixel is within incremental-mode circle centered at centerPos
+int abCircleIncCheck(const AbCircle *circle, const Vec2 *centerPos, const Vec2 *pixel)
+{
+  return circleIncContains(circle->radius, pixel->axes[0] - centerPos->axes[0],
+			   pixel->axes[1] - centerPos->axes[1]);
+}
   
 void
 abCircleGetBounds(const AbCircle *circle, const Vec2 *centerPos, Region *bounds)
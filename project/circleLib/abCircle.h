@@ -3,19 +3,6 @@
 
 #include "shape.h"
 
-/** AbShape circle
- *  
- *  chords should be a vector of length radius + 1.  
- *  Entry at index i is 1/2 chord length at distance i from the circle's center.  
- *  This vector can be generated using lcdLib's computeChordVec() (lcddraw.h).
- */ 
-typedef struct AbCircle_s {
-  void (*getBounds)(const struct AbCircle_s *circle, const Vec2 *centerPos, Region *bounds);
-  int (*check)(const struct AbCircle_s *circle, const Vec2 *centerPos, const Vec2 *pixel);
-  const u_char *chords;
-  const u_char radius;
-} AbCircle;
-
 /** Required by AbShape
  */
 void abCircleGetBounds(const AbCircle *circle, const Vec2 *circlePos, Region *bounds);
@@ -24,6 +11,173 @@ void abCircleGetBounds(const AbCircle *circle, const Vec2 *circlePos, Region *bo
  */
 int abCircleCheck(const AbCircle *circle, const Vec2 *circlePos, const Vec2 *pixel);
 
+/** Required by AbShape (incremental mode: no chord table)
+ *
+ *  Accepts the same pixels as abCircleCheck with makeCircles' table
+ *  (see circleIncContains in shape.h).
+ */
+int abCircleIncCheck(const AbCircle *circle, const Vec2 *circlePos, const Vec2 *pixel);
+
+/** Walks a circle's row spans from top to bottom.
+ *
+ *  Table-mode circles (chords != 0) derive each span from the chord table;
+ *  incremental-mode circles (chords == 0) update the squares in
+ *  makeCircles' error terms, costing amortized constant work per row,
+ *  no table lookups and no multiplies.
+ *  Spans match the shape's check function in both modes.
+ */
+typedef struct {
+  const u_char *chords;		/**< 0 in incremental mode */
+  int radius;
+  int row;			/**< current row offset from center */
+  int halfWidth;		/**< half width of span at row */
+  u_int radiusSq, rowSq, colSq;	/**< incremental: radius**2, row**2, halfWidth**2 */
+  u_char octant;		/**< incremental: circleOctant(radius) */
+} CircleSpanWalker;
+
+/** Prepare walker to emit circle's spans, starting at its top row.
+ */
+void abCircleSpanBegin(CircleSpanWalker *walker, const AbCircle *circle);
+
+/** Next row span of circle, relative to its center.
+ *
+ *  \param walker (in and out) walker state
+ *  \param rowOffset (out) row of span relative to center
+ *  \param halfWidth (out) span covers cols -halfWidth..halfWidth relative to center
+ *  \return 0 once all 2*radius + 1 rows have been emitted
+ */
+int abCircleSpanNext(CircleSpanWalker *walker, int *rowOffset, int *halfWidth);
+
+/** Fill a circle directly on the LCD (no layers).
+ *
+ *  Sends one single-row window per span from abCircleSpanNext(),
+ *  clipped to the screen, so cost grows with the circle's height
+ *  rather than its area.  Works for table and incremental circles.
+ */
+void fillCircle(const Vec2 *center, const AbCircle *circle, u_int colorBGR);
+
+/** Draw a circle's 1 pixel outline directly on the LCD.
+ *
+ *  Outline pixels are those of fillCircle() with a neighbor outside
+ *  the circle.  Each row is sent as at most two mirrored runs.
+ */
+void drawCircleOutline(const Vec2 *center, const AbCircle *circle, u_int colorBGR);
+
+/** Compute chord vector for a circle of given radius.
+ *
+ *  chordVec must have room for radius + 1 entries.
+ *  Uses Bresenham's circle algorithm (see computeChordVec.c).
+ */
+void computeChordVec(u_char chordVec[], u_char radius);
+
+/** Largest radius supported by AbDynCircle.
+ *  Each cache slot holds DYN_CIRCLE_MAX_RADIUS+1 chord entries.
+ */
+#ifndef DYN_CIRCLE_MAX_RADIUS
+#define DYN_CIRCLE_MAX_RADIUS 31
+#endif
+
+/** Number of chord vectors kept in the (LRU) chord cache.
+ *  RAM cost is DYN_CIRCLE_SLOTS * (DYN_CIRCLE_MAX_RADIUS + 2) bytes.
+ */
+#ifndef DYN_CIRCLE_SLOTS
+#define DYN_CIRCLE_SLOTS 2
+#endif
+
+/** AbShape circle whose radius may change at runtime
+ *
+ *  Unlike AbCircle, no chord table is stored in flash.  Chords are
+ *  computed on demand by computeChordVec() into a small LRU cache
+ *  shared by all AbDynCircles.  Radius is clamped to DYN_CIRCLE_MAX_RADIUS.
+ */
+typedef struct AbDynCircle_s {
+  void (*getBounds)(const struct AbDynCircle_s *circle, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbDynCircle_s *circle, const Vec2 *centerPos, const Vec2 *pixel);
+  u_char radius;
+} AbDynCircle;
+
+/** Required by AbShape
+ */
+void abDynCircleGetBounds(const AbDynCircle *circle, const Vec2 *circlePos, Region *bounds);
+
+/** Required by AbShape
+ */
+int abDynCircleCheck(const AbDynCircle *circle, const Vec2 *circlePos, const Vec2 *pixel);
+
+/** Change a dynamic circle's radius (clamped to DYN_CIRCLE_MAX_RADIUS).
+ *  Layers using this circle must be redrawn by the caller.
+ */
+void abDynCircleSetRadius(AbDynCircle *circle, u_char radius);
+
+/** Chord vector (radius + 1 entries) for a radius, from the chord cache.
+ *
+ *  The returned vector remains valid until DYN_CIRCLE_SLOTS other
+ *  radii have been requested.
+ */
+const u_char *dynCircleChords(u_char radius);
+
+/** AbSpanShape ellipse, optionally with an elliptical hole
+ *
+ *  outer is a vector of length outerRows + 1.  Entry at index i is the
+ *  1/2 width of the ellipse's row at distance i above or below its center.
+ *  Such vectors are generated by makeCircles (ellipseVecRXxRY, see ELLIPSES
+ *  in the Makefile); a circle's chordVecN works too.
+ *
+ *  inner describes the hole in the same way (innerRows + 1 entries), or is
+ *  0 for a filled ellipse.  An outlined ellipse is an ellipse whose hole
+ *  is a slightly smaller ellipse.
+ */
+typedef struct AbEllipse_s {
+  void (*getBounds)(const struct AbEllipse_s *ellipse, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbEllipse_s *ellipse, const Vec2 *centerPos, const Vec2 *pixel);
+  int (*getSpans)(const struct AbEllipse_s *ellipse, const Vec2 *centerPos, int row, Span *spans);
+  const u_char *outer, *inner;
+  const u_char outerRows, innerRows;
+} AbEllipse;
+
+/** A ring is an ellipse whose outer and inner edges are circles' chord vectors
+ *  (makeCircles generates ringO_I from chordVecO and chordVecI, see RINGS).
+ */
+typedef AbEllipse AbRing;
+
+/** Required by AbShape
+ */
+void abEllipseGetBounds(const AbEllipse *ellipse, const Vec2 *centerPos, Region *bounds);
+
+/** Required by AbShape
+ */
+int abEllipseCheck(const AbEllipse *ellipse, const Vec2 *centerPos, const Vec2 *pixel);
+
+/** Required by AbSpanShape
+ */
+int abEllipseGetSpans(const AbEllipse *ellipse, const Vec2 *centerPos, int row, Span *spans);
+
+/** AbSpanShape arc: the part of an ellipse or ring between two directions
+ *
+ *  start and end are (col, row) direction vectors from the center.  The arc
+ *  sweeps clockwise (as seen on screen) from start to end; sweeps of more
+ *  than 180 degrees are allowed.  Keep direction components within +/-127.
+ */
+typedef struct AbArc_s {
+  void (*getBounds)(const struct AbArc_s *arc, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbArc_s *arc, const Vec2 *centerPos, const Vec2 *pixel);
+  int (*getSpans)(const struct AbArc_s *arc, const Vec2 *centerPos, int row, Span *spans);
+  const AbEllipse *base;
+  const Vec2 start, end;
+} AbArc;
+
+/** Required by AbShape
+ */
+void abArcGetBounds(const AbArc *arc, const Vec2 *centerPos, Region *bounds);
+
+/** Required by AbShape
+ */
+int abArcCheck(const AbArc *arc, const Vec2 *centerPos, const Vec2 *pixel);
+
+/** Required by AbSpanShape
+ */
+int abArcGetSpans(const AbArc *arc, const Vec2 *centerPos, int row, Span *spans);
+
 #endif
 
 
@@ -181,5 +335,13 @@ extern const AbCircle circle147;
 extern const AbCircle circle148;
 extern const AbCircle circle149;
 extern const AbCircle circle150;
+extern const AbEllipse ellipse10x5;
+extern const AbEllipse ellipse20x10;
+extern const AbEllipse ellipse30x15;
+extern const AbEllipse ellipse5x10;
+extern const AbEllipse ellipse10x20;
+extern const AbRing ring10_8;
+extern const AbRing ring20_17;
+extern const AbRing ring30_26;
 
 #endif // included 
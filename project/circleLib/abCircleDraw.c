@@ -0,0 +1,58 @@
+#include "lcdutils.h"
+#include "lcddraw.h"
+#include "_abCircle.h"
+
+// fill cols colMin..colMax of one row, clipped to the screen
+static void circleRun(int colMin, int colMax, int row, u_int colorBGR)
+{
+  if (row < 0 || row >= screenHeight)
+    return;
+  if (colMin < 0) colMin = 0;
+  if (colMax >= screenWidth) colMax = screenWidth - 1;
+  if (colMin <= colMax)
+    fillRectangle(colMin, row, colMax - colMin + 1, 1, colorBGR);
+}
+
+void fillCircle(const Vec2 *center, const AbCircle *circle, u_int colorBGR)
+{
+  CircleSpanWalker walker;
+  int rowOffset, halfWidth;
+  abCircleSpanBegin(&walker, circle);
+  while (abCircleSpanNext(&walker, &rowOffset, &halfWidth))
+    circleRun(center->axes[0] - halfWidth, center->axes[0] + halfWidth,
+	      center->axes[1] + rowOffset, colorBGR);
+}
+
+// edge pixels of a row: cols farther out than the next row away from center
+static void outlineRow(const Vec2 *center, int rowOffset, int halfWidth,
+		       int outerHalfWidth, u_int colorBGR)
+{
+  int col = center->axes[0], row = center->axes[1] + rowOffset;
+  int inner = outerHalfWidth + 1; /* first col not covered by outer row */
+  if (inner >= halfWidth)	/* side walls: at least the end pixels */
+    inner = halfWidth;
+  if (inner <= 0) {		/* top or bottom cap: whole span */
+    circleRun(col - halfWidth, col + halfWidth, row, colorBGR);
+  } else {			/* mirrored runs on either side */
+    circleRun(col - halfWidth, col - inner, row, colorBGR);
+    circleRun(col + inner, col + halfWidth, row, colorBGR);
+  }
+}
+
+void drawCircleOutline(const Vec2 *center, const AbCircle *circle, u_int colorBGR)
+{
+  CircleSpanWalker walker;
+  int prevWidth = -1, rowOffset, halfWidth, nextOffset, nextWidth;
+  abCircleSpanBegin(&walker, circle);
+  if (!abCircleSpanNext(&walker, &rowOffset, &halfWidth))
+    return;
+  do {				/* look one row ahead for the lower half */
+    if (!abCircleSpanNext(&walker, &nextOffset, &nextWidth))
+      nextWidth = -1;
+    outlineRow(center, rowOffset, halfWidth,
+	       rowOffset < 0 ? prevWidth : nextWidth, colorBGR);
+    prevWidth = halfWidth;
+    rowOffset = nextOffset;
+    halfWidth = nextWidth;
+  } while (halfWidth >= 0);
+}
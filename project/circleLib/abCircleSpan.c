@@ -0,0 +1,78 @@
+#include "shape.h"
+#include "_abCircle.h"
+
+/* incremental: is col (colSq = col**2) inside walker's current row?
+   Same tests as circleIncHalfWidth, on squares kept up to date by adding */
+static int
+incInside(const CircleSpanWalker *w, int col, u_int colSq)
+{
+  int row = w->row < 0 ? -w->row : w->row;
+  if (!row)
+    return col <= w->radius;
+  if (col <= w->octant)
+    return colSq + w->rowSq - row < w->radiusSq;
+  return colSq + col + w->rowSq - 2 * row + 1 < w->radiusSq; /* (row-1)**2 */
+}
+
+// state for the circle's top row (row offset = -radius)
+void
+abCircleSpanBegin(CircleSpanWalker *w, const AbCircle *circle)
+{
+  int radius = circle->radius;
+  w->chords = circle->chords;
+  w->radius = radius;
+  w->row = -radius;
+  w->halfWidth = 0;
+  if (w->chords) {		/* table: widest col whose chord reaches top row */
+    while (w->halfWidth < radius && w->chords[w->halfWidth + 1] >= radius)
+      w->halfWidth++;
+  } else {			/* incremental: widest col inside top row */
+    w->radiusSq = (u_int)radius * radius;
+    w->rowSq = w->radiusSq;
+    w->colSq = 0;
+    w->octant = circleOctant(radius);
+    while (w->halfWidth < radius && incInside(w, w->halfWidth + 1, w->colSq + 2 * w->halfWidth + 1)) {
+      w->colSq += 2 * w->halfWidth + 1; /* (x+1)**2 - x**2 = 2x+1 */
+      w->halfWidth++;
+    }
+  }
+}
+
+// emit current span, then step walker down one row
+int
+abCircleSpanNext(CircleSpanWalker *w, int *rowOffset, int *halfWidth)
+{
+  int row = w->row, absRow;
+  if (row > w->radius)
+    return 0;
+  *rowOffset = row;
+  *halfWidth = w->halfWidth;
+
+  w->row = ++row;
+  if (row > w->radius)
+    return 1;
+  absRow = row < 0 ? -row : row;
+  if (w->chords) {
+    if (row <= 0) {		/* upper half: span widens */
+      while (w->halfWidth < w->radius && w->chords[w->halfWidth + 1] >= absRow)
+	w->halfWidth++;
+    } else {			/* lower half: span narrows */
+      while (w->chords[w->halfWidth] < absRow)
+	w->halfWidth--;
+    }
+  } else if (row <= 0) {	/* upper half: span widens */
+    w->rowSq -= 2 * absRow + 1;	/* (y+1)**2 - y**2 = 2y+1 */
+    while (w->halfWidth < w->radius &&
+	   incInside(w, w->halfWidth + 1, w->colSq + 2 * w->halfWidth + 1)) {
+      w->colSq += 2 * w->halfWidth + 1;
+      w->halfWidth++;
+    }
+  } else {			/* lower half: span narrows */
+    w->rowSq += 2 * absRow - 1;
+    while (!incInside(w, w->halfWidth, w->colSq)) {
+      w->halfWidth--;
+      w->colSq -= 2 * w->halfWidth + 1;
+    }
+  }
+  return 1;
+}
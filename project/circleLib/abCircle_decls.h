@@ -151,5 +151,13 @@ extern const AbCircle circle147;
 extern const AbCircle circle148;
 extern const AbCircle circle149;
 extern const AbCircle circle150;
+extern const AbEllipse ellipse10x5;
+extern const AbEllipse ellipse20x10;
+extern const AbEllipse ellipse30x15;
+extern const AbEllipse ellipse5x10;
+extern const AbEllipse ellipse10x20;
+extern const AbRing ring10_8;
+extern const AbRing ring20_17;
+extern const AbRing ring30_26;
 
 #endif // included 
@@ -0,0 +1,84 @@
+#include "shape.h"
+#include "_abCircle.h"
+
+/* chord cache: DYN_CIRCLE_SLOTS vectors carved from one static arena */
+static u_char chordArena[DYN_CIRCLE_SLOTS][DYN_CIRCLE_MAX_RADIUS + 1];
+static u_char slotRadius[DYN_CIRCLE_SLOTS]; /* radius cached in each slot */
+static u_char slotAge[DYN_CIRCLE_SLOTS];    /* 0 = most recently used */
+static u_char slotValid = 0;		    /* bit i set when slot i is filled */
+static u_char mruSlot = 0;
+
+// returns chord vector for radius, computing it into the LRU slot on a miss
+const u_char *
+dynCircleChords(u_char radius)
+{
+  u_char slot, victim = 0;
+  if (radius > DYN_CIRCLE_MAX_RADIUS)
+    radius = DYN_CIRCLE_MAX_RADIUS;
+  if ((slotValid & (1 << mruSlot)) && slotRadius[mruSlot] == radius)
+    return chordArena[mruSlot];	/* common case: same circle as last probe */
+
+  for (slot = 0; slot < DYN_CIRCLE_SLOTS; slot++) {
+    if (!(slotValid & (1 << slot))) { /* empty slot: use it */
+      victim = slot;
+      break;
+    }
+    if (slotRadius[slot] == radius) { /* hit */
+      victim = slot;
+      goto touch;
+    }
+    if (slotAge[slot] > slotAge[victim])
+      victim = slot;		/* least recently used so far */
+  }
+  computeChordVec(chordArena[victim], radius);
+  slotRadius[victim] = radius;
+  slotValid |= 1 << victim;
+  slotAge[victim] = DYN_CIRCLE_SLOTS; /* older than any other slot */
+
+ touch:
+  for (slot = 0; slot < DYN_CIRCLE_SLOTS; slot++)
+    if (slotAge[slot] < slotAge[victim])
+      slotAge[slot]++;		/* age everything younger than victim */
+  slotAge[victim] = 0;
+  mruSlot = victim;
+  return chordArena[victim];
+}
+
+/* radius actually drawn: circle's, clamped to what a chord slot holds */
+static u_char
+dynRadius(const AbDynCircle *circle)
+{
+  return (circle->radius > DYN_CIRCLE_MAX_RADIUS) ? DYN_CIRCLE_MAX_RADIUS : circle->radius;
+}
+
+void
+abDynCircleSetRadius(AbDynCircle *circle, u_char radius)
+{
+  circle->radius = (radius > DYN_CIRCLE_MAX_RADIUS) ? DYN_CIRCLE_MAX_RADIUS : radius;
+}
+
+// true if pixel is in circle centered at centerPos
+int
+abDynCircleCheck(const AbDynCircle *circle, const Vec2 *centerPos, const Vec2 *pixel)
+{
+  u_char radius = dynRadius(circle); /* may be statically initialized too large */
+  const u_char *chords;
+  Vec2 relPos;
+  vec2Sub(&relPos, pixel, centerPos); /* vector from center to pixel */
+  vec2Abs(&relPos);		      /* project to first quadrant */
+  if (relPos.axes[0] > radius)
+    return 0;
+  chords = dynCircleChords(radius);
+  return chords[relPos.axes[0]] >= relPos.axes[1];
+}
+
+void
+abDynCircleGetBounds(const AbDynCircle *circle, const Vec2 *centerPos, Region *bounds)
+{
+  u_char axis, radius = dynRadius(circle);
+  for (axis = 0; axis < 2; axis ++) {
+    bounds->topLeft.axes[axis] = centerPos->axes[axis] - radius;
+    bounds->botRight.axes[axis] = centerPos->axes[axis] + radius;
+  }
+  regionClipScreen(bounds);
+}
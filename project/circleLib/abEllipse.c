@@ -0,0 +1,66 @@
+#include "shape.h"
+#include "_abCircle.h"
+
+/* abShapeKind's callback for ellipses and rings */
+static u_char
+ellipseKind(const AbShape *s)
+{
+  return ((const AbEllipse *)s)->check == abEllipseCheck ? SHAPE_KIND_SPANS : SHAPE_KIND_OTHER;
+}
+
+static void __attribute__((constructor))
+ellipseRegisterKind()
+{
+  abShapeKindRegister(ellipseKind);
+}
+
+// true if pixel is in ellipse (and not its hole) centered at centerPos
+int
+abEllipseCheck(const AbEllipse *ellipse, const Vec2 *centerPos, const Vec2 *pixel)
+{
+  Vec2 relPos;
+  int col, row;
+  vec2Sub(&relPos, pixel, centerPos); /* vector from center to pixel */
+  vec2Abs(&relPos);		      /* project to first quadrant */
+  col = relPos.axes[0]; row = relPos.axes[1];
+  if (row > ellipse->outerRows || col > ellipse->outer[row])
+    return 0;
+  return !(ellipse->inner && row <= ellipse->innerRows && col <= ellipse->inner[row]);
+}
+
+void
+abEllipseGetBounds(const AbEllipse *ellipse, const Vec2 *centerPos, Region *bounds)
+{
+  int halfWidth = ellipse->outer[0], halfHeight = ellipse->outerRows;
+  bounds->topLeft.axes[0] = centerPos->axes[0] - halfWidth;
+  bounds->topLeft.axes[1] = centerPos->axes[1] - halfHeight;
+  bounds->botRight.axes[0] = centerPos->axes[0] + halfWidth;
+  bounds->botRight.axes[1] = centerPos->axes[1] + halfHeight;
+  regionClipScreen(bounds);
+}
+
+// one span, or two where row crosses the hole
+int
+abEllipseGetSpans(const AbEllipse *ellipse, const Vec2 *centerPos, int row, Span *spans)
+{
+  int center = centerPos->axes[0], halfWidth, holeHalfWidth;
+  row -= centerPos->axes[1];
+  if (row < 0)
+    row = -row;
+  if (row > ellipse->outerRows)
+    return 0;
+  halfWidth = ellipse->outer[row];
+  if (!ellipse->inner || row > ellipse->innerRows) {
+    spans[0].colMin = center - halfWidth;
+    spans[0].colMax = center + halfWidth;
+    return 1;
+  }
+  holeHalfWidth = ellipse->inner[row];
+  if (holeHalfWidth >= halfWidth)
+    return 0;			/* hole covers whole row */
+  spans[0].colMin = center - halfWidth;
+  spans[0].colMax = center - holeHalfWidth - 1;
+  spans[1].colMin = center + holeHalfWidth + 1;
+  spans[1].colMax = center + halfWidth;
+  return 2;
+}
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <time.h>
+#include "shape.h"
+#include "_abCircle.h"
+
+// Host benchmark: cost per row of walking circle spans
+// in table mode vs incremental mode.
+//
+// Build & run (on the host, not the msp430):  make bench
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define UNITS "cycles"
+static unsigned long long now() { return __rdtsc(); }
+#else
+#define UNITS "ns"
+static unsigned long long now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+#define REPS 20000
+
+volatile int sink;		/* defeats dead code elimination */
+
+static double
+perRow(const AbCircle *circle)
+{
+  unsigned long long start, elapsed;
+  long rows = 0;
+  int rep, rowOffset, halfWidth;
+  CircleSpanWalker walker;
+  start = now();
+  for (rep = 0; rep < REPS; rep++) {
+    abCircleSpanBegin(&walker, circle);
+    while (abCircleSpanNext(&walker, &rowOffset, &halfWidth)) {
+      sink += halfWidth;
+      rows++;
+    }
+  }
+  elapsed = now() - start;
+  return (double)elapsed / rows;
+}
+
+int
+main()
+{
+  static const u_char radii[] = {4, 8, 14, 30, 60, 150};
+  static u_char chords[151];
+  int i;
+  printf("radius   table(%s/row)   incremental(%s/row)\n", UNITS, UNITS);
+  for (i = 0; i < sizeof(radii); i++) {
+    u_char radius = radii[i];
+    computeChordVec(chords, radius);
+    {
+      AbCircle table = {abCircleGetBounds, abCircleCheck, chords, radius};
+      AbCircle inc = {abCircleGetBounds, abCircleIncCheck, 0, radius};
+      printf("%6d   %16.1f   %22.1f\n", radius, perRow(&table), perRow(&inc));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbEllipse ellipse10x20 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, ellipseVec10x20, 0, 20, 0};
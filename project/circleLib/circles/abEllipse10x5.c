@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbEllipse ellipse10x5 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, ellipseVec10x5, 0, 5, 0};
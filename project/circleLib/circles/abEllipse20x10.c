@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbEllipse ellipse20x10 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, ellipseVec20x10, 0, 10, 0};
@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbEllipse ellipse30x15 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, ellipseVec30x15, 0, 15, 0};
@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbEllipse ellipse5x10 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, ellipseVec5x10, 0, 10, 0};
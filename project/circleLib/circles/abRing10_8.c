@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbRing ring10_8 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, chordVec10, chordVec8, 10, 8};
@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbRing ring20_17 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, chordVec20, chordVec17, 20, 17};
@@ -0,0 +1,6 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "abCircle.h"
+
+#include "chordVec.h"
+
+const AbRing ring30_26 = {  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, chordVec30, chordVec26, 30, 26};
@@ -2,18 +2,18 @@
 #include "chordVec.h"
 
 const unsigned char chordVec128[129] = {
-    -128, // dist along axis = 0
-    -128, // dist along axis = 1
-    -128, // dist along axis = 2
-    -128, // dist along axis = 3
-    -128, // dist along axis = 4
-    -128, // dist along axis = 5
-    -128, // dist along axis = 6
-    -128, // dist along axis = 7
-    -128, // dist along axis = 8
-    -128, // dist along axis = 9
-    -128, // dist along axis = 10
-    -128, // dist along axis = 11
+    128, // dist along axis = 0
+    128, // dist along axis = 1
+    128, // dist along axis = 2
+    128, // dist along axis = 3
+    128, // dist along axis = 4
+    128, // dist along axis = 5
+    128, // dist along axis = 6
+    128, // dist along axis = 7
+    128, // dist along axis = 8
+    128, // dist along axis = 9
+    128, // dist along axis = 10
+    128, // dist along axis = 11
     127, // dist along axis = 12
     127, // dist along axis = 13
     127, // dist along axis = 14
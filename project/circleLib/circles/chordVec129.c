@@ -2,26 +2,26 @@
 #include "chordVec.h"
 
 const unsigned char chordVec129[130] = {
-    -127, // dist along axis = 0
-    -127, // dist along axis = 1
-    -127, // dist along axis = 2
-    -127, // dist along axis = 3
-    -127, // dist along axis = 4
-    -127, // dist along axis = 5
-    -127, // dist along axis = 6
-    -127, // dist along axis = 7
-    -127, // dist along axis = 8
-    -127, // dist along axis = 9
-    -127, // dist along axis = 10
-    -127, // dist along axis = 11
-    -128, // dist along axis = 12
-    -128, // dist along axis = 13
-    -128, // dist along axis = 14
-    -128, // dist along axis = 15
-    -128, // dist along axis = 16
-    -128, // dist along axis = 17
-    -128, // dist along axis = 18
-    -128, // dist along axis = 19
+    129, // dist along axis = 0
+    129, // dist along axis = 1
+    129, // dist along axis = 2
+    129, // dist along axis = 3
+    129, // dist along axis = 4
+    129, // dist along axis = 5
+    129, // dist along axis = 6
+    129, // dist along axis = 7
+    129, // dist along axis = 8
+    129, // dist along axis = 9
+    129, // dist along axis = 10
+    129, // dist along axis = 11
+    128, // dist along axis = 12
+    128, // dist along axis = 13
+    128, // dist along axis = 14
+    128, // dist along axis = 15
+    128, // dist along axis = 16
+    128, // dist along axis = 17
+    128, // dist along axis = 18
+    128, // dist along axis = 19
     127, // dist along axis = 20
     127, // dist along axis = 21
     127, // dist along axis = 22
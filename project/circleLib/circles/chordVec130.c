@@ -2,32 +2,32 @@
 #include "chordVec.h"
 
 const unsigned char chordVec130[131] = {
-    -126, // dist along axis = 0
-    -126, // dist along axis = 1
-    -126, // dist along axis = 2
-    -126, // dist along axis = 3
-    -126, // dist along axis = 4
-    -126, // dist along axis = 5
-    -126, // dist along axis = 6
-    -126, // dist along axis = 7
-    -126, // dist along axis = 8
-    -126, // dist along axis = 9
-    -126, // dist along axis = 10
-    -126, // dist along axis = 11
-    -127, // dist along axis = 12
-    -127, // dist along axis = 13
-    -127, // dist along axis = 14
-    -127, // dist along axis = 15
-    -127, // dist along axis = 16
-    -127, // dist along axis = 17
-    -127, // dist along axis = 18
-    -127, // dist along axis = 19
-    -128, // dist along axis = 20
-    -128, // dist along axis = 21
-    -128, // dist along axis = 22
-    -128, // dist along axis = 23
-    -128, // dist along axis = 24
-    -128, // dist along axis = 25
+    130, // dist along axis = 0
+    130, // dist along axis = 1
+    130, // dist along axis = 2
+    130, // dist along axis = 3
+    130, // dist along axis = 4
+    130, // dist along axis = 5
+    130, // dist along axis = 6
+    130, // dist along axis = 7
+    130, // dist along axis = 8
+    130, // dist along axis = 9
+    130, // dist along axis = 10
+    130, // dist along axis = 11
+    129, // dist along axis = 12
+    129, // dist along axis = 13
+    129, // dist along axis = 14
+    129, // dist along axis = 15
+    129, // dist along axis = 16
+    129, // dist along axis = 17
+    129, // dist along axis = 18
+    129, // dist along axis = 19
+    128, // dist along axis = 20
+    128, // dist along axis = 21
+    128, // dist along axis = 22
+    128, // dist along axis = 23
+    128, // dist along axis = 24
+    128, // dist along axis = 25
     127, // dist along axis = 26
     127, // dist along axis = 27
     127, // dist along axis = 28
@@ -2,37 +2,37 @@
 #include "chordVec.h"
 
 const unsigned char chordVec131[132] = {
-    -125, // dist along axis = 0
-    -125, // dist along axis = 1
-    -125, // dist along axis = 2
-    -125, // dist along axis = 3
-    -125, // dist along axis = 4
-    -125, // dist along axis = 5
-    -125, // dist along axis = 6
-    -125, // dist along axis = 7
-    -125, // dist along axis = 8
-    -125, // dist along axis = 9
-    -125, // dist along axis = 10
-    -125, // dist along axis = 11
-    -126, // dist along axis = 12
-    -126, // dist along axis = 13
-    -126, // dist along axis = 14
-    -126, // dist along axis = 15
-    -126, // dist along axis = 16
-    -126, // dist along axis = 17
-    -126, // dist along axis = 18
-    -126, // dist along axis = 19
-    -127, // dist along axis = 20
-    -127, // dist along axis = 21
-    -127, // dist along axis = 22
-    -127, // dist along axis = 23
-    -127, // dist along axis = 24
-    -127, // dist along axis = 25
-    -128, // dist along axis = 26
-    -128, // dist along axis = 27
-    -128, // dist along axis = 28
-    -128, // dist along axis = 29
-    -128, // dist along axis = 30
+    131, // dist along axis = 0
+    131, // dist along axis = 1
+    131, // dist along axis = 2
+    131, // dist along axis = 3
+    131, // dist along axis = 4
+    131, // dist along axis = 5
+    131, // dist along axis = 6
+    131, // dist along axis = 7
+    131, // dist along axis = 8
+    131, // dist along axis = 9
+    131, // dist along axis = 10
+    131, // dist along axis = 11
+    130, // dist along axis = 12
+    130, // dist along axis = 13
+    130, // dist along axis = 14
+    130, // dist along axis = 15
+    130, // dist along axis = 16
+    130, // dist along axis = 17
+    130, // dist along axis = 18
+    130, // dist along axis = 19
+    129, // dist along axis = 20
+    129, // dist along axis = 21
+    129, // dist along axis = 22
+    129, // dist along axis = 23
+    129, // dist along axis = 24
+    129, // dist along axis = 25
+    128, // dist along axis = 26
+    128, // dist along axis = 27
+    128, // dist along axis = 28
+    128, // dist along axis = 29
+    128, // dist along axis = 30
     127, // dist along axis = 31
     127, // dist along axis = 32
     127, // dist along axis = 33
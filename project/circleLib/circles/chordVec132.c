@@ -2,41 +2,41 @@
 #include "chordVec.h"
 
 const unsigned char chordVec132[133] = {
-    -124, // dist along axis = 0
-    -124, // dist along axis = 1
-    -124, // dist along axis = 2
-    -124, // dist along axis = 3
-    -124, // dist along axis = 4
-    -124, // dist along axis = 5
-    -124, // dist along axis = 6
-    -124, // dist along axis = 7
-    -124, // dist along axis = 8
-    -124, // dist along axis = 9
-    -124, // dist along axis = 10
-    -124, // dist along axis = 11
-    -125, // dist along axis = 12
-    -125, // dist along axis = 13
-    -125, // dist along axis = 14
-    -125, // dist along axis = 15
-    -125, // dist along axis = 16
-    -125, // dist along axis = 17
-    -125, // dist along axis = 18
-    -125, // dist along axis = 19
-    -126, // dist along axis = 20
-    -126, // dist along axis = 21
-    -126, // dist along axis = 22
-    -126, // dist along axis = 23
-    -126, // dist along axis = 24
-    -126, // dist along axis = 25
-    -127, // dist along axis = 26
-    -127, // dist along axis = 27
-    -127, // dist along axis = 28
-    -127, // dist along axis = 29
-    -127, // dist along axis = 30
-    -128, // dist along axis = 31
-    -128, // dist along axis = 32
-    -128, // dist along axis = 33
-    -128, // dist along axis = 34
+    132, // dist along axis = 0
+    132, // dist along axis = 1
+    132, // dist along axis = 2
+    132, // dist along axis = 3
+    132, // dist along axis = 4
+    132, // dist along axis = 5
+    132, // dist along axis = 6
+    132, // dist along axis = 7
+    132, // dist along axis = 8
+    132, // dist along axis = 9
+    132, // dist along axis = 10
+    132, // dist along axis = 11
+    131, // dist along axis = 12
+    131, // dist along axis = 13
+    131, // dist along axis = 14
+    131, // dist along axis = 15
+    131, // dist along axis = 16
+    131, // dist along axis = 17
+    131, // dist along axis = 18
+    131, // dist along axis = 19
+    130, // dist along axis = 20
+    130, // dist along axis = 21
+    130, // dist along axis = 22
+    130, // dist along axis = 23
+    130, // dist along axis = 24
+    130, // dist along axis = 25
+    129, // dist along axis = 26
+    129, // dist along axis = 27
+    129, // dist along axis = 28
+    129, // dist along axis = 29
+    129, // dist along axis = 30
+    128, // dist along axis = 31
+    128, // dist along axis = 32
+    128, // dist along axis = 33
+    128, // dist along axis = 34
     127, // dist along axis = 35
     127, // dist along axis = 36
     127, // dist along axis = 37
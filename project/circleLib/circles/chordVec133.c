@@ -2,44 +2,44 @@
 #include "chordVec.h"
 
 const unsigned char chordVec133[134] = {
-    -123, // dist along axis = 0
-    -123, // dist along axis = 1
-    -123, // dist along axis = 2
-    -123, // dist along axis = 3
-    -123, // dist along axis = 4
-    -123, // dist along axis = 5
-    -123, // dist along axis = 6
-    -123, // dist along axis = 7
-    -123, // dist along axis = 8
-    -123, // dist along axis = 9
-    -123, // dist along axis = 10
-    -123, // dist along axis = 11
-    -124, // dist along axis = 12
-    -124, // dist along axis = 13
-    -124, // dist along axis = 14
-    -124, // dist along axis = 15
-    -124, // dist along axis = 16
-    -124, // dist along axis = 17
-    -124, // dist along axis = 18
-    -124, // dist along axis = 19
-    -125, // dist along axis = 20
-    -125, // dist along axis = 21
-    -125, // dist along axis = 22
-    -125, // dist along axis = 23
-    -125, // dist along axis = 24
-    -125, // dist along axis = 25
-    -126, // dist along axis = 26
-    -126, // dist along axis = 27
-    -126, // dist along axis = 28
-    -126, // dist along axis = 29
-    -126, // dist along axis = 30
-    -127, // dist along axis = 31
-    -127, // dist along axis = 32
-    -127, // dist along axis = 33
-    -127, // dist along axis = 34
-    -128, // dist along axis = 35
-    -128, // dist along axis = 36
-    -128, // dist along axis = 37
+    133, // dist along axis = 0
+    133, // dist along axis = 1
+    133, // dist along axis = 2
+    133, // dist along axis = 3
+    133, // dist along axis = 4
+    133, // dist along axis = 5
+    133, // dist along axis = 6
+    133, // dist along axis = 7
+    133, // dist along axis = 8
+    133, // dist along axis = 9
+    133, // dist along axis = 10
+    133, // dist along axis = 11
+    132, // dist along axis = 12
+    132, // dist along axis = 13
+    132, // dist along axis = 14
+    132, // dist along axis = 15
+    132, // dist along axis = 16
+    132, // dist along axis = 17
+    132, // dist along axis = 18
+    132, // dist along axis = 19
+    131, // dist along axis = 20
+    131, // dist along axis = 21
+    131, // dist along axis = 22
+    131, // dist along axis = 23
+    131, // dist along axis = 24
+    131, // dist along axis = 25
+    130, // dist along axis = 26
+    130, // dist along axis = 27
+    130, // dist along axis = 28
+    130, // dist along axis = 29
+    130, // dist along axis = 30
+    129, // dist along axis = 31
+    129, // dist along axis = 32
+    129, // dist along axis = 33
+    129, // dist along axis = 34
+    128, // dist along axis = 35
+    128, // dist along axis = 36
+    128, // dist along axis = 37
     127, // dist along axis = 38
     127, // dist along axis = 39
     127, // dist along axis = 40
@@ -2,48 +2,48 @@
 #include "chordVec.h"
 
 const unsigned char chordVec134[135] = {
-    -122, // dist along axis = 0
-    -122, // dist along axis = 1
-    -122, // dist along axis = 2
-    -122, // dist along axis = 3
-    -122, // dist along axis = 4
-    -122, // dist along axis = 5
-    -122, // dist along axis = 6
-    -122, // dist along axis = 7
-    -122, // dist along axis = 8
-    -122, // dist along axis = 9
-    -122, // dist along axis = 10
-    -122, // dist along axis = 11
-    -123, // dist along axis = 12
-    -123, // dist along axis = 13
-    -123, // dist along axis = 14
-    -123, // dist along axis = 15
-    -123, // dist along axis = 16
-    -123, // dist along axis = 17
-    -123, // dist along axis = 18
-    -123, // dist along axis = 19
-    -124, // dist along axis = 20
-    -124, // dist along axis = 21
-    -124, // dist along axis = 22
-    -124, // dist along axis = 23
-    -124, // dist along axis = 24
-    -124, // dist along axis = 25
-    -125, // dist along axis = 26
-    -125, // dist along axis = 27
-    -125, // dist along axis = 28
-    -125, // dist along axis = 29
-    -125, // dist along axis = 30
-    -126, // dist along axis = 31
-    -126, // dist along axis = 32
-    -126, // dist along axis = 33
-    -126, // dist along axis = 34
-    -127, // dist along axis = 35
-    -127, // dist along axis = 36
-    -127, // dist along axis = 37
-    -128, // dist along axis = 38
-    -128, // dist along axis = 39
-    -128, // dist along axis = 40
-    -128, // dist along axis = 41
+    134, // dist along axis = 0
+    134, // dist along axis = 1
+    134, // dist along axis = 2
+    134, // dist along axis = 3
+    134, // dist along axis = 4
+    134, // dist along axis = 5
+    134, // dist along axis = 6
+    134, // dist along axis = 7
+    134, // dist along axis = 8
+    134, // dist along axis = 9
+    134, // dist along axis = 10
+    134, // dist along axis = 11
+    133, // dist along axis = 12
+    133, // dist along axis = 13
+    133, // dist along axis = 14
+    133, // dist along axis = 15
+    133, // dist along axis = 16
+    133, // dist along axis = 17
+    133, // dist along axis = 18
+    133, // dist along axis = 19
+    132, // dist along axis = 20
+    132, // dist along axis = 21
+    132, // dist along axis = 22
+    132, // dist along axis = 23
+    132, // dist along axis = 24
+    132, // dist along axis = 25
+    131, // dist along axis = 26
+    131, // dist along axis = 27
+    131, // dist along axis = 28
+    131, // dist along axis = 29
+    131, // dist along axis = 30
+    130, // dist along axis = 31
+    130, // dist along axis = 32
+    130, // dist along axis = 33
+    130, // dist along axis = 34
+    129, // dist along axis = 35
+    129, // dist along axis = 36
+    129, // dist along axis = 37
+    128, // dist along axis = 38
+    128, // dist along axis = 39
+    128, // dist along axis = 40
+    128, // dist along axis = 41
     127, // dist along axis = 42
     127, // dist along axis = 43
     127, // dist along axis = 44
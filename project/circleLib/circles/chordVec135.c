@@ -2,51 +2,51 @@
 #include "chordVec.h"
 
 const unsigned char chordVec135[136] = {
-    -121, // dist along axis = 0
-    -121, // dist along axis = 1
-    -121, // dist along axis = 2
-    -121, // dist along axis = 3
-    -121, // dist along axis = 4
-    -121, // dist along axis = 5
-    -121, // dist along axis = 6
-    -121, // dist along axis = 7
-    -121, // dist along axis = 8
-    -121, // dist along axis = 9
-    -121, // dist along axis = 10
-    -121, // dist along axis = 11
-    -122, // dist along axis = 12
-    -122, // dist along axis = 13
-    -122, // dist along axis = 14
-    -122, // dist along axis = 15
-    -122, // dist along axis = 16
-    -122, // dist along axis = 17
-    -122, // dist along axis = 18
-    -122, // dist along axis = 19
-    -122, // dist along axis = 20
-    -123, // dist along axis = 21
-    -123, // dist along axis = 22
-    -123, // dist along axis = 23
-    -123, // dist along axis = 24
-    -123, // dist along axis = 25
-    -124, // dist along axis = 26
-    -124, // dist along axis = 27
-    -124, // dist along axis = 28
-    -124, // dist along axis = 29
-    -124, // dist along axis = 30
-    -125, // dist along axis = 31
-    -125, // dist along axis = 32
-    -125, // dist along axis = 33
-    -125, // dist along axis = 34
-    -126, // dist along axis = 35
-    -126, // dist along axis = 36
-    -126, // dist along axis = 37
-    -126, // dist along axis = 38
-    -127, // dist along axis = 39
-    -127, // dist along axis = 40
-    -127, // dist along axis = 41
-    -128, // dist along axis = 42
-    -128, // dist along axis = 43
-    -128, // dist along axis = 44
+    135, // dist along axis = 0
+    135, // dist along axis = 1
+    135, // dist along axis = 2
+    135, // dist along axis = 3
+    135, // dist along axis = 4
+    135, // dist along axis = 5
+    135, // dist along axis = 6
+    135, // dist along axis = 7
+    135, // dist along axis = 8
+    135, // dist along axis = 9
+    135, // dist along axis = 10
+    135, // dist along axis = 11
+    134, // dist along axis = 12
+    134, // dist along axis = 13
+    134, // dist along axis = 14
+    134, // dist along axis = 15
+    134, // dist along axis = 16
+    134, // dist along axis = 17
+    134, // dist along axis = 18
+    134, // dist along axis = 19
+    134, // dist along axis = 20
+    133, // dist along axis = 21
+    133, // dist along axis = 22
+    133, // dist along axis = 23
+    133, // dist along axis = 24
+    133, // dist along axis = 25
+    132, // dist along axis = 26
+    132, // dist along axis = 27
+    132, // dist along axis = 28
+    132, // dist along axis = 29
+    132, // dist along axis = 30
+    131, // dist along axis = 31
+    131, // dist along axis = 32
+    131, // dist along axis = 33
+    131, // dist along axis = 34
+    130, // dist along axis = 35
+    130, // dist along axis = 36
+    130, // dist along axis = 37
+    130, // dist along axis = 38
+    129, // dist along axis = 39
+    129, // dist along axis = 40
+    129, // dist along axis = 41
+    128, // dist along axis = 42
+    128, // dist along axis = 43
+    128, // dist along axis = 44
     127, // dist along axis = 45
     127, // dist along axis = 46
     127, // dist along axis = 47
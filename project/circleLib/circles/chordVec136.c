@@ -2,54 +2,54 @@
 #include "chordVec.h"
 
 const unsigned char chordVec136[137] = {
-    -120, // dist along axis = 0
-    -120, // dist along axis = 1
-    -120, // dist along axis = 2
-    -120, // dist along axis = 3
-    -120, // dist along axis = 4
-    -120, // dist along axis = 5
-    -120, // dist along axis = 6
-    -120, // dist along axis = 7
-    -120, // dist along axis = 8
-    -120, // dist along axis = 9
-    -120, // dist along axis = 10
-    -120, // dist along axis = 11
-    -121, // dist along axis = 12
-    -121, // dist along axis = 13
-    -121, // dist along axis = 14
-    -121, // dist along axis = 15
-    -121, // dist along axis = 16
-    -121, // dist along axis = 17
-    -121, // dist along axis = 18
-    -121, // dist along axis = 19
-    -121, // dist along axis = 20
-    -122, // dist along axis = 21
-    -122, // dist along axis = 22
-    -122, // dist along axis = 23
-    -122, // dist along axis = 24
-    -122, // dist along axis = 25
-    -123, // dist along axis = 26
-    -123, // dist along axis = 27
-    -123, // dist along axis = 28
-    -123, // dist along axis = 29
-    -123, // dist along axis = 30
-    -124, // dist along axis = 31
-    -124, // dist along axis = 32
-    -124, // dist along axis = 33
-    -124, // dist along axis = 34
-    -125, // dist along axis = 35
-    -125, // dist along axis = 36
-    -125, // dist along axis = 37
-    -125, // dist along axis = 38
-    -126, // dist along axis = 39
-    -126, // dist along axis = 40
-    -126, // dist along axis = 41
-    -127, // dist along axis = 42
-    -127, // dist along axis = 43
-    -127, // dist along axis = 44
-    -128, // dist along axis = 45
-    -128, // dist along axis = 46
-    -128, // dist along axis = 47
+    136, // dist along axis = 0
+    136, // dist along axis = 1
+    136, // dist along axis = 2
+    136, // dist along axis = 3
+    136, // dist along axis = 4
+    136, // dist along axis = 5
+    136, // dist along axis = 6
+    136, // dist along axis = 7
+    136, // dist along axis = 8
+    136, // dist along axis = 9
+    136, // dist along axis = 10
+    136, // dist along axis = 11
+    135, // dist along axis = 12
+    135, // dist along axis = 13
+    135, // dist along axis = 14
+    135, // dist along axis = 15
+    135, // dist along axis = 16
+    135, // dist along axis = 17
+    135, // dist along axis = 18
+    135, // dist along axis = 19
+    135, // dist along axis = 20
+    134, // dist along axis = 21
+    134, // dist along axis = 22
+    134, // dist along axis = 23
+    134, // dist along axis = 24
+    134, // dist along axis = 25
+    133, // dist along axis = 26
+    133, // dist along axis = 27
+    133, // dist along axis = 28
+    133, // dist along axis = 29
+    133, // dist along axis = 30
+    132, // dist along axis = 31
+    132, // dist along axis = 32
+    132, // dist along axis = 33
+    132, // dist along axis = 34
+    131, // dist along axis = 35
+    131, // dist along axis = 36
+    131, // dist along axis = 37
+    131, // dist along axis = 38
+    130, // dist along axis = 39
+    130, // dist along axis = 40
+    130, // dist along axis = 41
+    129, // dist along axis = 42
+    129, // dist along axis = 43
+    129, // dist along axis = 44
+    128, // dist along axis = 45
+    128, // dist along axis = 46
+    128, // dist along axis = 47
     127, // dist along axis = 48
     127, // dist along axis = 49
     126, // dist along axis = 50
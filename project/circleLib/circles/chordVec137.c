@@ -2,57 +2,57 @@
 #include "chordVec.h"
 
 const unsigned char chordVec137[138] = {
-    -119, // dist along axis = 0
-    -119, // dist along axis = 1
-    -119, // dist along axis = 2
-    -119, // dist along axis = 3
-    -119, // dist along axis = 4
-    -119, // dist along axis = 5
-    -119, // dist along axis = 6
-    -119, // dist along axis = 7
-    -119, // dist along axis = 8
-    -119, // dist along axis = 9
-    -119, // dist along axis = 10
-    -119, // dist along axis = 11
-    -120, // dist along axis = 12
-    -120, // dist along axis = 13
-    -120, // dist along axis = 14
-    -120, // dist along axis = 15
-    -120, // dist along axis = 16
-    -120, // dist along axis = 17
-    -120, // dist along axis = 18
-    -120, // dist along axis = 19
-    -120, // dist along axis = 20
-    -121, // dist along axis = 21
-    -121, // dist along axis = 22
-    -121, // dist along axis = 23
-    -121, // dist along axis = 24
-    -121, // dist along axis = 25
-    -121, // dist along axis = 26
-    -122, // dist along axis = 27
-    -122, // dist along axis = 28
-    -122, // dist along axis = 29
-    -122, // dist along axis = 30
-    -123, // dist along axis = 31
-    -123, // dist along axis = 32
-    -123, // dist along axis = 33
-    -123, // dist along axis = 34
-    -124, // dist along axis = 35
-    -124, // dist along axis = 36
-    -124, // dist along axis = 37
-    -124, // dist along axis = 38
-    -125, // dist along axis = 39
-    -125, // dist along axis = 40
-    -125, // dist along axis = 41
-    -126, // dist along axis = 42
-    -126, // dist along axis = 43
-    -126, // dist along axis = 44
-    -127, // dist along axis = 45
-    -127, // dist along axis = 46
-    -127, // dist along axis = 47
-    -128, // dist along axis = 48
-    -128, // dist along axis = 49
-    -128, // dist along axis = 50
+    137, // dist along axis = 0
+    137, // dist along axis = 1
+    137, // dist along axis = 2
+    137, // dist along axis = 3
+    137, // dist along axis = 4
+    137, // dist along axis = 5
+    137, // dist along axis = 6
+    137, // dist along axis = 7
+    137, // dist along axis = 8
+    137, // dist along axis = 9
+    137, // dist along axis = 10
+    137, // dist along axis = 11
+    136, // dist along axis = 12
+    136, // dist along axis = 13
+    136, // dist along axis = 14
+    136, // dist along axis = 15
+    136, // dist along axis = 16
+    136, // dist along axis = 17
+    136, // dist along axis = 18
+    136, // dist along axis = 19
+    136, // dist along axis = 20
+    135, // dist along axis = 21
+    135, // dist along axis = 22
+    135, // dist along axis = 23
+    135, // dist along axis = 24
+    135, // dist along axis = 25
+    135, // dist along axis = 26
+    134, // dist along axis = 27
+    134, // dist along axis = 28
+    134, // dist along axis = 29
+    134, // dist along axis = 30
+    133, // dist along axis = 31
+    133, // dist along axis = 32
+    133, // dist along axis = 33
+    133, // dist along axis = 34
+    132, // dist along axis = 35
+    132, // dist along axis = 36
+    132, // dist along axis = 37
+    132, // dist along axis = 38
+    131, // dist along axis = 39
+    131, // dist along axis = 40
+    131, // dist along axis = 41
+    130, // dist along axis = 42
+    130, // dist along axis = 43
+    130, // dist along axis = 44
+    129, // dist along axis = 45
+    129, // dist along axis = 46
+    129, // dist along axis = 47
+    128, // dist along axis = 48
+    128, // dist along axis = 49
+    128, // dist along axis = 50
     127, // dist along axis = 51
     127, // dist along axis = 52
     126, // dist along axis = 53
@@ -2,59 +2,59 @@
 #include "chordVec.h"
 
 const unsigned char chordVec138[139] = {
-    -118, // dist along axis = 0
-    -118, // dist along axis = 1
-    -118, // dist along axis = 2
-    -118, // dist along axis = 3
-    -118, // dist along axis = 4
-    -118, // dist along axis = 5
-    -118, // dist along axis = 6
-    -118, // dist along axis = 7
-    -118, // dist along axis = 8
-    -118, // dist along axis = 9
-    -118, // dist along axis = 10
-    -118, // dist along axis = 11
-    -119, // dist along axis = 12
-    -119, // dist along axis = 13
-    -119, // dist along axis = 14
-    -119, // dist along axis = 15
-    -119, // dist along axis = 16
-    -119, // dist along axis = 17
-    -119, // dist along axis = 18
-    -119, // dist along axis = 19
-    -119, // dist along axis = 20
-    -120, // dist along axis = 21
-    -120, // dist along axis = 22
-    -120, // dist along axis = 23
-    -120, // dist along axis = 24
-    -120, // dist along axis = 25
-    -120, // dist along axis = 26
-    -121, // dist along axis = 27
-    -121, // dist along axis = 28
-    -121, // dist along axis = 29
-    -121, // dist along axis = 30
-    -122, // dist along axis = 31
-    -122, // dist along axis = 32
-    -122, // dist along axis = 33
-    -122, // dist along axis = 34
-    -123, // dist along axis = 35
-    -123, // dist along axis = 36
-    -123, // dist along axis = 37
-    -123, // dist along axis = 38
-    -124, // dist along axis = 39
-    -124, // dist along axis = 40
-    -124, // dist along axis = 41
-    -125, // dist along axis = 42
-    -125, // dist along axis = 43
-    -125, // dist along axis = 44
-    -126, // dist along axis = 45
-    -126, // dist along axis = 46
-    -126, // dist along axis = 47
-    -127, // dist along axis = 48
-    -127, // dist along axis = 49
-    -127, // dist along axis = 50
-    -128, // dist along axis = 51
-    -128, // dist along axis = 52
+    138, // dist along axis = 0
+    138, // dist along axis = 1
+    138, // dist along axis = 2
+    138, // dist along axis = 3
+    138, // dist along axis = 4
+    138, // dist along axis = 5
+    138, // dist along axis = 6
+    138, // dist along axis = 7
+    138, // dist along axis = 8
+    138, // dist along axis = 9
+    138, // dist along axis = 10
+    138, // dist along axis = 11
+    137, // dist along axis = 12
+    137, // dist along axis = 13
+    137, // dist along axis = 14
+    137, // dist along axis = 15
+    137, // dist along axis = 16
+    137, // dist along axis = 17
+    137, // dist along axis = 18
+    137, // dist along axis = 19
+    137, // dist along axis = 20
+    136, // dist along axis = 21
+    136, // dist along axis = 22
+    136, // dist along axis = 23
+    136, // dist along axis = 24
+    136, // dist along axis = 25
+    136, // dist along axis = 26
+    135, // dist along axis = 27
+    135, // dist along axis = 28
+    135, // dist along axis = 29
+    135, // dist along axis = 30
+    134, // dist along axis = 31
+    134, // dist along axis = 32
+    134, // dist along axis = 33
+    134, // dist along axis = 34
+    133, // dist along axis = 35
+    133, // dist along axis = 36
+    133, // dist along axis = 37
+    133, // dist along axis = 38
+    132, // dist along axis = 39
+    132, // dist along axis = 40
+    132, // dist along axis = 41
+    131, // dist along axis = 42
+    131, // dist along axis = 43
+    131, // dist along axis = 44
+    130, // dist along axis = 45
+    130, // dist along axis = 46
+    130, // dist along axis = 47
+    129, // dist along axis = 48
+    129, // dist along axis = 49
+    129, // dist along axis = 50
+    128, // dist along axis = 51
+    128, // dist along axis = 52
     127, // dist along axis = 53
     127, // dist along axis = 54
     127, // dist along axis = 55
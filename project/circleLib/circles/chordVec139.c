@@ -2,62 +2,62 @@
 #include "chordVec.h"
 
 const unsigned char chordVec139[140] = {
-    -117, // dist along axis = 0
-    -117, // dist along axis = 1
-    -117, // dist along axis = 2
-    -117, // dist along axis = 3
-    -117, // dist along axis = 4
-    -117, // dist along axis = 5
-    -117, // dist along axis = 6
-    -117, // dist along axis = 7
-    -117, // dist along axis = 8
-    -117, // dist along axis = 9
-    -117, // dist along axis = 10
-    -117, // dist along axis = 11
-    -118, // dist along axis = 12
-    -118, // dist along axis = 13
-    -118, // dist along axis = 14
-    -118, // dist along axis = 15
-    -118, // dist along axis = 16
-    -118, // dist along axis = 17
-    -118, // dist along axis = 18
-    -118, // dist along axis = 19
-    -118, // dist along axis = 20
-    -119, // dist along axis = 21
-    -119, // dist along axis = 22
-    -119, // dist along axis = 23
-    -119, // dist along axis = 24
-    -119, // dist along axis = 25
-    -119, // dist along axis = 26
-    -120, // dist along axis = 27
-    -120, // dist along axis = 28
-    -120, // dist along axis = 29
-    -120, // dist along axis = 30
-    -121, // dist along axis = 31
-    -121, // dist along axis = 32
-    -121, // dist along axis = 33
-    -121, // dist along axis = 34
-    -121, // dist along axis = 35
-    -122, // dist along axis = 36
-    -122, // dist along axis = 37
-    -122, // dist along axis = 38
-    -123, // dist along axis = 39
-    -123, // dist along axis = 40
-    -123, // dist along axis = 41
-    -123, // dist along axis = 42
-    -124, // dist along axis = 43
-    -124, // dist along axis = 44
-    -124, // dist along axis = 45
-    -125, // dist along axis = 46
-    -125, // dist along axis = 47
-    -126, // dist along axis = 48
-    -126, // dist along axis = 49
-    -126, // dist along axis = 50
-    -127, // dist along axis = 51
-    -127, // dist along axis = 52
-    -128, // dist along axis = 53
-    -128, // dist along axis = 54
-    -128, // dist along axis = 55
+    139, // dist along axis = 0
+    139, // dist along axis = 1
+    139, // dist along axis = 2
+    139, // dist along axis = 3
+    139, // dist along axis = 4
+    139, // dist along axis = 5
+    139, // dist along axis = 6
+    139, // dist along axis = 7
+    139, // dist along axis = 8
+    139, // dist along axis = 9
+    139, // dist along axis = 10
+    139, // dist along axis = 11
+    138, // dist along axis = 12
+    138, // dist along axis = 13
+    138, // dist along axis = 14
+    138, // dist along axis = 15
+    138, // dist along axis = 16
+    138, // dist along axis = 17
+    138, // dist along axis = 18
+    138, // dist along axis = 19
+    138, // dist along axis = 20
+    137, // dist along axis = 21
+    137, // dist along axis = 22
+    137, // dist along axis = 23
+    137, // dist along axis = 24
+    137, // dist along axis = 25
+    137, // dist along axis = 26
+    136, // dist along axis = 27
+    136, // dist along axis = 28
+    136, // dist along axis = 29
+    136, // dist along axis = 30
+    135, // dist along axis = 31
+    135, // dist along axis = 32
+    135, // dist along axis = 33
+    135, // dist along axis = 34
+    135, // dist along axis = 35
+    134, // dist along axis = 36
+    134, // dist along axis = 37
+    134, // dist along axis = 38
+    133, // dist along axis = 39
+    133, // dist along axis = 40
+    133, // dist along axis = 41
+    133, // dist along axis = 42
+    132, // dist along axis = 43
+    132, // dist along axis = 44
+    132, // dist along axis = 45
+    131, // dist along axis = 46
+    131, // dist along axis = 47
+    130, // dist along axis = 48
+    130, // dist along axis = 49
+    130, // dist along axis = 50
+    129, // dist along axis = 51
+    129, // dist along axis = 52
+    128, // dist along axis = 53
+    128, // dist along axis = 54
+    128, // dist along axis = 55
     127, // dist along axis = 56
     127, // dist along axis = 57
     126, // dist along axis = 58
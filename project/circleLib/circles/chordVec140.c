@@ -2,64 +2,64 @@
 #include "chordVec.h"
 
 const unsigned char chordVec140[141] = {
-    -116, // dist along axis = 0
-    -116, // dist along axis = 1
-    -116, // dist along axis = 2
-    -116, // dist along axis = 3
-    -116, // dist along axis = 4
-    -116, // dist along axis = 5
-    -116, // dist along axis = 6
-    -116, // dist along axis = 7
-    -116, // dist along axis = 8
-    -116, // dist along axis = 9
-    -116, // dist along axis = 10
-    -116, // dist along axis = 11
-    -117, // dist along axis = 12
-    -117, // dist along axis = 13
-    -117, // dist along axis = 14
-    -117, // dist along axis = 15
-    -117, // dist along axis = 16
-    -117, // dist along axis = 17
-    -117, // dist along axis = 18
-    -117, // dist along axis = 19
-    -117, // dist along axis = 20
-    -118, // dist along axis = 21
-    -118, // dist along axis = 22
-    -118, // dist along axis = 23
-    -118, // dist along axis = 24
-    -118, // dist along axis = 25
-    -118, // dist along axis = 26
-    -119, // dist along axis = 27
-    -119, // dist along axis = 28
-    -119, // dist along axis = 29
-    -119, // dist along axis = 30
-    -119, // dist along axis = 31
-    -120, // dist along axis = 32
-    -120, // dist along axis = 33
-    -120, // dist along axis = 34
-    -120, // dist along axis = 35
-    -121, // dist along axis = 36
-    -121, // dist along axis = 37
-    -121, // dist along axis = 38
-    -122, // dist along axis = 39
-    -122, // dist along axis = 40
-    -122, // dist along axis = 41
-    -122, // dist along axis = 42
-    -123, // dist along axis = 43
-    -123, // dist along axis = 44
-    -123, // dist along axis = 45
-    -124, // dist along axis = 46
-    -124, // dist along axis = 47
-    -124, // dist along axis = 48
-    -125, // dist along axis = 49
-    -125, // dist along axis = 50
-    -126, // dist along axis = 51
-    -126, // dist along axis = 52
-    -126, // dist along axis = 53
-    -127, // dist along axis = 54
-    -127, // dist along axis = 55
-    -128, // dist along axis = 56
-    -128, // dist along axis = 57
+    140, // dist along axis = 0
+    140, // dist along axis = 1
+    140, // dist along axis = 2
+    140, // dist along axis = 3
+    140, // dist along axis = 4
+    140, // dist along axis = 5
+    140, // dist along axis = 6
+    140, // dist along axis = 7
+    140, // dist along axis = 8
+    140, // dist along axis = 9
+    140, // dist along axis = 10
+    140, // dist along axis = 11
+    139, // dist along axis = 12
+    139, // dist along axis = 13
+    139, // dist along axis = 14
+    139, // dist along axis = 15
+    139, // dist along axis = 16
+    139, // dist along axis = 17
+    139, // dist along axis = 18
+    139, // dist along axis = 19
+    139, // dist along axis = 20
+    138, // dist along axis = 21
+    138, // dist along axis = 22
+    138, // dist along axis = 23
+    138, // dist along axis = 24
+    138, // dist along axis = 25
+    138, // dist along axis = 26
+    137, // dist along axis = 27
+    137, // dist along axis = 28
+    137, // dist along axis = 29
+    137, // dist along axis = 30
+    137, // dist along axis = 31
+    136, // dist along axis = 32
+    136, // dist along axis = 33
+    136, // dist along axis = 34
+    136, // dist along axis = 35
+    135, // dist along axis = 36
+    135, // dist along axis = 37
+    135, // dist along axis = 38
+    134, // dist along axis = 39
+    134, // dist along axis = 40
+    134, // dist along axis = 41
+    134, // dist along axis = 42
+    133, // dist along axis = 43
+    133, // dist along axis = 44
+    133, // dist along axis = 45
+    132, // dist along axis = 46
+    132, // dist along axis = 47
+    132, // dist along axis = 48
+    131, // dist along axis = 49
+    131, // dist along axis = 50
+    130, // dist along axis = 51
+    130, // dist along axis = 52
+    130, // dist along axis = 53
+    129, // dist along axis = 54
+    129, // dist along axis = 55
+    128, // dist along axis = 56
+    128, // dist along axis = 57
     127, // dist along axis = 58
     127, // dist along axis = 59
     126, // dist along axis = 60
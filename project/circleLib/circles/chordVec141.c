@@ -2,67 +2,67 @@
 #include "chordVec.h"
 
 const unsigned char chordVec141[142] = {
-    -115, // dist along axis = 0
-    -115, // dist along axis = 1
-    -115, // dist along axis = 2
-    -115, // dist along axis = 3
-    -115, // dist along axis = 4
-    -115, // dist along axis = 5
-    -115, // dist along axis = 6
-    -115, // dist along axis = 7
-    -115, // dist along axis = 8
-    -115, // dist along axis = 9
-    -115, // dist along axis = 10
-    -115, // dist along axis = 11
-    -116, // dist along axis = 12
-    -116, // dist along axis = 13
-    -116, // dist along axis = 14
-    -116, // dist along axis = 15
-    -116, // dist along axis = 16
-    -116, // dist along axis = 17
-    -116, // dist along axis = 18
-    -116, // dist along axis = 19
-    -116, // dist along axis = 20
-    -117, // dist along axis = 21
-    -117, // dist along axis = 22
-    -117, // dist along axis = 23
-    -117, // dist along axis = 24
-    -117, // dist along axis = 25
-    -117, // dist along axis = 26
-    -118, // dist along axis = 27
-    -118, // dist along axis = 28
-    -118, // dist along axis = 29
-    -118, // dist along axis = 30
-    -118, // dist along axis = 31
-    -119, // dist along axis = 32
-    -119, // dist along axis = 33
-    -119, // dist along axis = 34
-    -119, // dist along axis = 35
-    -120, // dist along axis = 36
-    -120, // dist along axis = 37
-    -120, // dist along axis = 38
-    -121, // dist along axis = 39
-    -121, // dist along axis = 40
-    -121, // dist along axis = 41
-    -121, // dist along axis = 42
-    -122, // dist along axis = 43
-    -122, // dist along axis = 44
-    -122, // dist along axis = 45
-    -123, // dist along axis = 46
-    -123, // dist along axis = 47
-    -123, // dist along axis = 48
-    -124, // dist along axis = 49
-    -124, // dist along axis = 50
-    -125, // dist along axis = 51
-    -125, // dist along axis = 52
-    -125, // dist along axis = 53
-    -126, // dist along axis = 54
-    -126, // dist along axis = 55
-    -127, // dist along axis = 56
-    -127, // dist along axis = 57
-    -127, // dist along axis = 58
-    -128, // dist along axis = 59
-    -128, // dist along axis = 60
+    141, // dist along axis = 0
+    141, // dist along axis = 1
+    141, // dist along axis = 2
+    141, // dist along axis = 3
+    141, // dist along axis = 4
+    141, // dist along axis = 5
+    141, // dist along axis = 6
+    141, // dist along axis = 7
+    141, // dist along axis = 8
+    141, // dist along axis = 9
+    141, // dist along axis = 10
+    141, // dist along axis = 11
+    140, // dist along axis = 12
+    140, // dist along axis = 13
+    140, // dist along axis = 14
+    140, // dist along axis = 15
+    140, // dist along axis = 16
+    140, // dist along axis = 17
+    140, // dist along axis = 18
+    140, // dist along axis = 19
+    140, // dist along axis = 20
+    139, // dist along axis = 21
+    139, // dist along axis = 22
+    139, // dist along axis = 23
+    139, // dist along axis = 24
+    139, // dist along axis = 25
+    139, // dist along axis = 26
+    138, // dist along axis = 27
+    138, // dist along axis = 28
+    138, // dist along axis = 29
+    138, // dist along axis = 30
+    138, // dist along axis = 31
+    137, // dist along axis = 32
+    137, // dist along axis = 33
+    137, // dist along axis = 34
+    137, // dist along axis = 35
+    136, // dist along axis = 36
+    136, // dist along axis = 37
+    136, // dist along axis = 38
+    135, // dist along axis = 39
+    135, // dist along axis = 40
+    135, // dist along axis = 41
+    135, // dist along axis = 42
+    134, // dist along axis = 43
+    134, // dist along axis = 44
+    134, // dist along axis = 45
+    133, // dist along axis = 46
+    133, // dist along axis = 47
+    133, // dist along axis = 48
+    132, // dist along axis = 49
+    132, // dist along axis = 50
+    131, // dist along axis = 51
+    131, // dist along axis = 52
+    131, // dist along axis = 53
+    130, // dist along axis = 54
+    130, // dist along axis = 55
+    129, // dist along axis = 56
+    129, // dist along axis = 57
+    129, // dist along axis = 58
+    128, // dist along axis = 59
+    128, // dist along axis = 60
     127, // dist along axis = 61
     127, // dist along axis = 62
     126, // dist along axis = 63
@@ -2,69 +2,69 @@
 #include "chordVec.h"
 
 const unsigned char chordVec142[143] = {
-    -114, // dist along axis = 0
-    -114, // dist along axis = 1
-    -114, // dist along axis = 2
-    -114, // dist along axis = 3
-    -114, // dist along axis = 4
-    -114, // dist along axis = 5
-    -114, // dist along axis = 6
-    -114, // dist along axis = 7
-    -114, // dist along axis = 8
-    -114, // dist along axis = 9
-    -114, // dist along axis = 10
-    -114, // dist along axis = 11
-    -115, // dist along axis = 12
-    -115, // dist along axis = 13
-    -115, // dist along axis = 14
-    -115, // dist along axis = 15
-    -115, // dist along axis = 16
-    -115, // dist along axis = 17
-    -115, // dist along axis = 18
-    -115, // dist along axis = 19
-    -115, // dist along axis = 20
-    -116, // dist along axis = 21
-    -116, // dist along axis = 22
-    -116, // dist along axis = 23
-    -116, // dist along axis = 24
-    -116, // dist along axis = 25
-    -116, // dist along axis = 26
-    -117, // dist along axis = 27
-    -117, // dist along axis = 28
-    -117, // dist along axis = 29
-    -117, // dist along axis = 30
-    -117, // dist along axis = 31
-    -118, // dist along axis = 32
-    -118, // dist along axis = 33
-    -118, // dist along axis = 34
-    -118, // dist along axis = 35
-    -119, // dist along axis = 36
-    -119, // dist along axis = 37
-    -119, // dist along axis = 38
-    -119, // dist along axis = 39
-    -120, // dist along axis = 40
-    -120, // dist along axis = 41
-    -120, // dist along axis = 42
-    -121, // dist along axis = 43
-    -121, // dist along axis = 44
-    -121, // dist along axis = 45
-    -122, // dist along axis = 46
-    -122, // dist along axis = 47
-    -122, // dist along axis = 48
-    -123, // dist along axis = 49
-    -123, // dist along axis = 50
-    -123, // dist along axis = 51
-    -124, // dist along axis = 52
-    -124, // dist along axis = 53
-    -125, // dist along axis = 54
-    -125, // dist along axis = 55
-    -126, // dist along axis = 56
-    -126, // dist along axis = 57
-    -126, // dist along axis = 58
-    -127, // dist along axis = 59
-    -127, // dist along axis = 60
-    -128, // dist along axis = 61
-    -128, // dist along axis = 62
+    142, // dist along axis = 0
+    142, // dist along axis = 1
+    142, // dist along axis = 2
+    142, // dist along axis = 3
+    142, // dist along axis = 4
+    142, // dist along axis = 5
+    142, // dist along axis = 6
+    142, // dist along axis = 7
+    142, // dist along axis = 8
+    142, // dist along axis = 9
+    142, // dist along axis = 10
+    142, // dist along axis = 11
+    141, // dist along axis = 12
+    141, // dist along axis = 13
+    141, // dist along axis = 14
+    141, // dist along axis = 15
+    141, // dist along axis = 16
+    141, // dist along axis = 17
+    141, // dist along axis = 18
+    141, // dist along axis = 19
+    141, // dist along axis = 20
+    140, // dist along axis = 21
+    140, // dist along axis = 22
+    140, // dist along axis = 23
+    140, // dist along axis = 24
+    140, // dist along axis = 25
+    140, // dist along axis = 26
+    139, // dist along axis = 27
+    139, // dist along axis = 28
+    139, // dist along axis = 29
+    139, // dist along axis = 30
+    139, // dist along axis = 31
+    138, // dist along axis = 32
+    138, // dist along axis = 33
+    138, // dist along axis = 34
+    138, // dist along axis = 35
+    137, // dist along axis = 36
+    137, // dist along axis = 37
+    137, // dist along axis = 38
+    137, // dist along axis = 39
+    136, // dist along axis = 40
+    136, // dist along axis = 41
+    136, // dist along axis = 42
+    135, // dist along axis = 43
+    135, // dist along axis = 44
+    135, // dist along axis = 45
+    134, // dist along axis = 46
+    134, // dist along axis = 47
+    134, // dist along axis = 48
+    133, // dist along axis = 49
+    133, // dist along axis = 50
+    133, // dist along axis = 51
+    132, // dist along axis = 52
+    132, // dist along axis = 53
+    131, // dist along axis = 54
+    131, // dist along axis = 55
+    130, // dist along axis = 56
+    130, // dist along axis = 57
+    130, // dist along axis = 58
+    129, // dist along axis = 59
+    129, // dist along axis = 60
+    128, // dist along axis = 61
+    128, // dist along axis = 62
     127, // dist along axis = 63
     127, // dist along axis = 64
     126, // dist along axis = 65
@@ -2,71 +2,71 @@
 #include "chordVec.h"
 
 const unsigned char chordVec143[144] = {
-    -113, // dist along axis = 0
-    -113, // dist along axis = 1
-    -113, // dist along axis = 2
-    -113, // dist along axis = 3
-    -113, // dist along axis = 4
-    -113, // dist along axis = 5
-    -113, // dist along axis = 6
-    -113, // dist along axis = 7
-    -113, // dist along axis = 8
-    -113, // dist along axis = 9
-    -113, // dist along axis = 10
-    -113, // dist along axis = 11
-    -114, // dist along axis = 12
-    -114, // dist along axis = 13
-    -114, // dist along axis = 14
-    -114, // dist along axis = 15
-    -114, // dist along axis = 16
-    -114, // dist along axis = 17
-    -114, // dist along axis = 18
-    -114, // dist along axis = 19
-    -114, // dist along axis = 20
-    -115, // dist along axis = 21
-    -115, // dist along axis = 22
-    -115, // dist along axis = 23
-    -115, // dist along axis = 24
-    -115, // dist along axis = 25
-    -115, // dist along axis = 26
-    -116, // dist along axis = 27
-    -116, // dist along axis = 28
-    -116, // dist along axis = 29
-    -116, // dist along axis = 30
-    -116, // dist along axis = 31
-    -117, // dist along axis = 32
-    -117, // dist along axis = 33
-    -117, // dist along axis = 34
-    -117, // dist along axis = 35
-    -118, // dist along axis = 36
-    -118, // dist along axis = 37
-    -118, // dist along axis = 38
-    -118, // dist along axis = 39
-    -119, // dist along axis = 40
-    -119, // dist along axis = 41
-    -119, // dist along axis = 42
-    -120, // dist along axis = 43
-    -120, // dist along axis = 44
-    -120, // dist along axis = 45
-    -121, // dist along axis = 46
-    -121, // dist along axis = 47
-    -121, // dist along axis = 48
-    -122, // dist along axis = 49
-    -122, // dist along axis = 50
-    -122, // dist along axis = 51
-    -123, // dist along axis = 52
-    -123, // dist along axis = 53
-    -124, // dist along axis = 54
-    -124, // dist along axis = 55
-    -124, // dist along axis = 56
-    -125, // dist along axis = 57
-    -125, // dist along axis = 58
-    -126, // dist along axis = 59
-    -126, // dist along axis = 60
-    -127, // dist along axis = 61
-    -127, // dist along axis = 62
-    -128, // dist along axis = 63
-    -128, // dist along axis = 64
+    143, // dist along axis = 0
+    143, // dist along axis = 1
+    143, // dist along axis = 2
+    143, // dist along axis = 3
+    143, // dist along axis = 4
+    143, // dist along axis = 5
+    143, // dist along axis = 6
+    143, // dist along axis = 7
+    143, // dist along axis = 8
+    143, // dist along axis = 9
+    143, // dist along axis = 10
+    143, // dist along axis = 11
+    142, // dist along axis = 12
+    142, // dist along axis = 13
+    142, // dist along axis = 14
+    142, // dist along axis = 15
+    142, // dist along axis = 16
+    142, // dist along axis = 17
+    142, // dist along axis = 18
+    142, // dist along axis = 19
+    142, // dist along axis = 20
+    141, // dist along axis = 21
+    141, // dist along axis = 22
+    141, // dist along axis = 23
+    141, // dist along axis = 24
+    141, // dist along axis = 25
+    141, // dist along axis = 26
+    140, // dist along axis = 27
+    140, // dist along axis = 28
+    140, // dist along axis = 29
+    140, // dist along axis = 30
+    140, // dist along axis = 31
+    139, // dist along axis = 32
+    139, // dist along axis = 33
+    139, // dist along axis = 34
+    139, // dist along axis = 35
+    138, // dist along axis = 36
+    138, // dist along axis = 37
+    138, // dist along axis = 38
+    138, // dist along axis = 39
+    137, // dist along axis = 40
+    137, // dist along axis = 41
+    137, // dist along axis = 42
+    136, // dist along axis = 43
+    136, // dist along axis = 44
+    136, // dist along axis = 45
+    135, // dist along axis = 46
+    135, // dist along axis = 47
+    135, // dist along axis = 48
+    134, // dist along axis = 49
+    134, // dist along axis = 50
+    134, // dist along axis = 51
+    133, // dist along axis = 52
+    133, // dist along axis = 53
+    132, // dist along axis = 54
+    132, // dist along axis = 55
+    132, // dist along axis = 56
+    131, // dist along axis = 57
+    131, // dist along axis = 58
+    130, // dist along axis = 59
+    130, // dist along axis = 60
+    129, // dist along axis = 61
+    129, // dist along axis = 62
+    128, // dist along axis = 63
+    128, // dist along axis = 64
     127, // dist along axis = 65
     127, // dist along axis = 66
     126, // dist along axis = 67
@@ -2,73 +2,73 @@
 #include "chordVec.h"
 
 const unsigned char chordVec144[145] = {
-    -112, // dist along axis = 0
-    -112, // dist along axis = 1
-    -112, // dist along axis = 2
-    -112, // dist along axis = 3
-    -112, // dist along axis = 4
-    -112, // dist along axis = 5
-    -112, // dist along axis = 6
-    -112, // dist along axis = 7
-    -112, // dist along axis = 8
-    -112, // dist along axis = 9
-    -112, // dist along axis = 10
-    -112, // dist along axis = 11
-    -113, // dist along axis = 12
-    -113, // dist along axis = 13
-    -113, // dist along axis = 14
-    -113, // dist along axis = 15
-    -113, // dist along axis = 16
-    -113, // dist along axis = 17
-    -113, // dist along axis = 18
-    -113, // dist along axis = 19
-    -113, // dist along axis = 20
-    -114, // dist along axis = 21
-    -114, // dist along axis = 22
-    -114, // dist along axis = 23
-    -114, // dist along axis = 24
-    -114, // dist along axis = 25
-    -114, // dist along axis = 26
-    -115, // dist along axis = 27
-    -115, // dist along axis = 28
-    -115, // dist along axis = 29
-    -115, // dist along axis = 30
-    -115, // dist along axis = 31
-    -116, // dist along axis = 32
-    -116, // dist along axis = 33
-    -116, // dist along axis = 34
-    -116, // dist along axis = 35
-    -117, // dist along axis = 36
-    -117, // dist along axis = 37
-    -117, // dist along axis = 38
-    -117, // dist along axis = 39
-    -118, // dist along axis = 40
-    -118, // dist along axis = 41
-    -118, // dist along axis = 42
-    -119, // dist along axis = 43
-    -119, // dist along axis = 44
-    -119, // dist along axis = 45
-    -120, // dist along axis = 46
-    -120, // dist along axis = 47
-    -120, // dist along axis = 48
-    -121, // dist along axis = 49
-    -121, // dist along axis = 50
-    -121, // dist along axis = 51
-    -122, // dist along axis = 52
-    -122, // dist along axis = 53
-    -123, // dist along axis = 54
-    -123, // dist along axis = 55
-    -123, // dist along axis = 56
-    -124, // dist along axis = 57
-    -124, // dist along axis = 58
-    -125, // dist along axis = 59
-    -125, // dist along axis = 60
-    -126, // dist along axis = 61
-    -126, // dist along axis = 62
-    -127, // dist along axis = 63
-    -127, // dist along axis = 64
-    -128, // dist along axis = 65
-    -128, // dist along axis = 66
+    144, // dist along axis = 0
+    144, // dist along axis = 1
+    144, // dist along axis = 2
+    144, // dist along axis = 3
+    144, // dist along axis = 4
+    144, // dist along axis = 5
+    144, // dist along axis = 6
+    144, // dist along axis = 7
+    144, // dist along axis = 8
+    144, // dist along axis = 9
+    144, // dist along axis = 10
+    144, // dist along axis = 11
+    143, // dist along axis = 12
+    143, // dist along axis = 13
+    143, // dist along axis = 14
+    143, // dist along axis = 15
+    143, // dist along axis = 16
+    143, // dist along axis = 17
+    143, // dist along axis = 18
+    143, // dist along axis = 19
+    143, // dist along axis = 20
+    142, // dist along axis = 21
+    142, // dist along axis = 22
+    142, // dist along axis = 23
+    142, // dist along axis = 24
+    142, // dist along axis = 25
+    142, // dist along axis = 26
+    141, // dist along axis = 27
+    141, // dist along axis = 28
+    141, // dist along axis = 29
+    141, // dist along axis = 30
+    141, // dist along axis = 31
+    140, // dist along axis = 32
+    140, // dist along axis = 33
+    140, // dist along axis = 34
+    140, // dist along axis = 35
+    139, // dist along axis = 36
+    139, // dist along axis = 37
+    139, // dist along axis = 38
+    139, // dist along axis = 39
+    138, // dist along axis = 40
+    138, // dist along axis = 41
+    138, // dist along axis = 42
+    137, // dist along axis = 43
+    137, // dist along axis = 44
+    137, // dist along axis = 45
+    136, // dist along axis = 46
+    136, // dist along axis = 47
+    136, // dist along axis = 48
+    135, // dist along axis = 49
+    135, // dist along axis = 50
+    135, // dist along axis = 51
+    134, // dist along axis = 52
+    134, // dist along axis = 53
+    133, // dist along axis = 54
+    133, // dist along axis = 55
+    133, // dist along axis = 56
+    132, // dist along axis = 57
+    132, // dist along axis = 58
+    131, // dist along axis = 59
+    131, // dist along axis = 60
+    130, // dist along axis = 61
+    130, // dist along axis = 62
+    129, // dist along axis = 63
+    129, // dist along axis = 64
+    128, // dist along axis = 65
+    128, // dist along axis = 66
     127, // dist along axis = 67
     127, // dist along axis = 68
     126, // dist along axis = 69
@@ -2,76 +2,76 @@
 #include "chordVec.h"
 
 const unsigned char chordVec145[146] = {
-    -111, // dist along axis = 0
-    -111, // dist along axis = 1
-    -111, // dist along axis = 2
-    -111, // dist along axis = 3
-    -111, // dist along axis = 4
-    -111, // dist along axis = 5
-    -111, // dist along axis = 6
-    -111, // dist along axis = 7
-    -111, // dist along axis = 8
-    -111, // dist along axis = 9
-    -111, // dist along axis = 10
-    -111, // dist along axis = 11
-    -111, // dist along axis = 12
-    -112, // dist along axis = 13
-    -112, // dist along axis = 14
-    -112, // dist along axis = 15
-    -112, // dist along axis = 16
-    -112, // dist along axis = 17
-    -112, // dist along axis = 18
-    -112, // dist along axis = 19
-    -112, // dist along axis = 20
-    -113, // dist along axis = 21
-    -113, // dist along axis = 22
-    -113, // dist along axis = 23
-    -113, // dist along axis = 24
-    -113, // dist along axis = 25
-    -113, // dist along axis = 26
-    -114, // dist along axis = 27
-    -114, // dist along axis = 28
-    -114, // dist along axis = 29
-    -114, // dist along axis = 30
-    -114, // dist along axis = 31
-    -115, // dist along axis = 32
-    -115, // dist along axis = 33
-    -115, // dist along axis = 34
-    -115, // dist along axis = 35
-    -116, // dist along axis = 36
-    -116, // dist along axis = 37
-    -116, // dist along axis = 38
-    -116, // dist along axis = 39
-    -117, // dist along axis = 40
-    -117, // dist along axis = 41
-    -117, // dist along axis = 42
-    -118, // dist along axis = 43
-    -118, // dist along axis = 44
-    -118, // dist along axis = 45
-    -118, // dist along axis = 46
-    -119, // dist along axis = 47
-    -119, // dist along axis = 48
-    -120, // dist along axis = 49
-    -120, // dist along axis = 50
-    -120, // dist along axis = 51
-    -121, // dist along axis = 52
-    -121, // dist along axis = 53
-    -121, // dist along axis = 54
-    -122, // dist along axis = 55
-    -122, // dist along axis = 56
-    -123, // dist along axis = 57
-    -123, // dist along axis = 58
-    -124, // dist along axis = 59
-    -124, // dist along axis = 60
-    -124, // dist along axis = 61
-    -125, // dist along axis = 62
-    -125, // dist along axis = 63
-    -126, // dist along axis = 64
-    -126, // dist along axis = 65
-    -127, // dist along axis = 66
-    -127, // dist along axis = 67
-    -128, // dist along axis = 68
-    -128, // dist along axis = 69
+    145, // dist along axis = 0
+    145, // dist along axis = 1
+    145, // dist along axis = 2
+    145, // dist along axis = 3
+    145, // dist along axis = 4
+    145, // dist along axis = 5
+    145, // dist along axis = 6
+    145, // dist along axis = 7
+    145, // dist along axis = 8
+    145, // dist along axis = 9
+    145, // dist along axis = 10
+    145, // dist along axis = 11
+    145, // dist along axis = 12
+    144, // dist along axis = 13
+    144, // dist along axis = 14
+    144, // dist along axis = 15
+    144, // dist along axis = 16
+    144, // dist along axis = 17
+    144, // dist along axis = 18
+    144, // dist along axis = 19
+    144, // dist along axis = 20
+    143, // dist along axis = 21
+    143, // dist along axis = 22
+    143, // dist along axis = 23
+    143, // dist along axis = 24
+    143, // dist along axis = 25
+    143, // dist along axis = 26
+    142, // dist along axis = 27
+    142, // dist along axis = 28
+    142, // dist along axis = 29
+    142, // dist along axis = 30
+    142, // dist along axis = 31
+    141, // dist along axis = 32
+    141, // dist along axis = 33
+    141, // dist along axis = 34
+    141, // dist along axis = 35
+    140, // dist along axis = 36
+    140, // dist along axis = 37
+    140, // dist along axis = 38
+    140, // dist along axis = 39
+    139, // dist along axis = 40
+    139, // dist along axis = 41
+    139, // dist along axis = 42
+    138, // dist along axis = 43
+    138, // dist along axis = 44
+    138, // dist along axis = 45
+    138, // dist along axis = 46
+    137, // dist along axis = 47
+    137, // dist along axis = 48
+    136, // dist along axis = 49
+    136, // dist along axis = 50
+    136, // dist along axis = 51
+    135, // dist along axis = 52
+    135, // dist along axis = 53
+    135, // dist along axis = 54
+    134, // dist along axis = 55
+    134, // dist along axis = 56
+    133, // dist along axis = 57
+    133, // dist along axis = 58
+    132, // dist along axis = 59
+    132, // dist along axis = 60
+    132, // dist along axis = 61
+    131, // dist along axis = 62
+    131, // dist along axis = 63
+    130, // dist along axis = 64
+    130, // dist along axis = 65
+    129, // dist along axis = 66
+    129, // dist along axis = 67
+    128, // dist along axis = 68
+    128, // dist along axis = 69
     127, // dist along axis = 70
     126, // dist along axis = 71
     126, // dist along axis = 72
@@ -2,78 +2,78 @@
 #include "chordVec.h"
 
 const unsigned char chordVec146[147] = {
-    -110, // dist along axis = 0
-    -110, // dist along axis = 1
-    -110, // dist along axis = 2
-    -110, // dist along axis = 3
-    -110, // dist along axis = 4
-    -110, // dist along axis = 5
-    -110, // dist along axis = 6
-    -110, // dist along axis = 7
-    -110, // dist along axis = 8
-    -110, // dist along axis = 9
-    -110, // dist along axis = 10
-    -110, // dist along axis = 11
-    -110, // dist along axis = 12
-    -111, // dist along axis = 13
-    -111, // dist along axis = 14
-    -111, // dist along axis = 15
-    -111, // dist along axis = 16
-    -111, // dist along axis = 17
-    -111, // dist along axis = 18
-    -111, // dist along axis = 19
-    -111, // dist along axis = 20
-    -112, // dist along axis = 21
-    -112, // dist along axis = 22
-    -112, // dist along axis = 23
-    -112, // dist along axis = 24
-    -112, // dist along axis = 25
-    -112, // dist along axis = 26
-    -113, // dist along axis = 27
-    -113, // dist along axis = 28
-    -113, // dist along axis = 29
-    -113, // dist along axis = 30
-    -113, // dist along axis = 31
-    -114, // dist along axis = 32
-    -114, // dist along axis = 33
-    -114, // dist along axis = 34
-    -114, // dist along axis = 35
-    -115, // dist along axis = 36
-    -115, // dist along axis = 37
-    -115, // dist along axis = 38
-    -115, // dist along axis = 39
-    -116, // dist along axis = 40
-    -116, // dist along axis = 41
-    -116, // dist along axis = 42
-    -116, // dist along axis = 43
-    -117, // dist along axis = 44
-    -117, // dist along axis = 45
-    -117, // dist along axis = 46
-    -118, // dist along axis = 47
-    -118, // dist along axis = 48
-    -118, // dist along axis = 49
-    -119, // dist along axis = 50
-    -119, // dist along axis = 51
-    -120, // dist along axis = 52
-    -120, // dist along axis = 53
-    -120, // dist along axis = 54
-    -121, // dist along axis = 55
-    -121, // dist along axis = 56
-    -122, // dist along axis = 57
-    -122, // dist along axis = 58
-    -122, // dist along axis = 59
-    -123, // dist along axis = 60
-    -123, // dist along axis = 61
-    -124, // dist along axis = 62
-    -124, // dist along axis = 63
-    -125, // dist along axis = 64
-    -125, // dist along axis = 65
-    -126, // dist along axis = 66
-    -126, // dist along axis = 67
-    -127, // dist along axis = 68
-    -127, // dist along axis = 69
-    -128, // dist along axis = 70
-    -128, // dist along axis = 71
+    146, // dist along axis = 0
+    146, // dist along axis = 1
+    146, // dist along axis = 2
+    146, // dist along axis = 3
+    146, // dist along axis = 4
+    146, // dist along axis = 5
+    146, // dist along axis = 6
+    146, // dist along axis = 7
+    146, // dist along axis = 8
+    146, // dist along axis = 9
+    146, // dist along axis = 10
+    146, // dist along axis = 11
+    146, // dist along axis = 12
+    145, // dist along axis = 13
+    145, // dist along axis = 14
+    145, // dist along axis = 15
+    145, // dist along axis = 16
+    145, // dist along axis = 17
+    145, // dist along axis = 18
+    145, // dist along axis = 19
+    145, // dist along axis = 20
+    144, // dist along axis = 21
+    144, // dist along axis = 22
+    144, // dist along axis = 23
+    144, // dist along axis = 24
+    144, // dist along axis = 25
+    144, // dist along axis = 26
+    143, // dist along axis = 27
+    143, // dist along axis = 28
+    143, // dist along axis = 29
+    143, // dist along axis = 30
+    143, // dist along axis = 31
+    142, // dist along axis = 32
+    142, // dist along axis = 33
+    142, // dist along axis = 34
+    142, // dist along axis = 35
+    141, // dist along axis = 36
+    141, // dist along axis = 37
+    141, // dist along axis = 38
+    141, // dist along axis = 39
+    140, // dist along axis = 40
+    140, // dist along axis = 41
+    140, // dist along axis = 42
+    140, // dist along axis = 43
+    139, // dist along axis = 44
+    139, // dist along axis = 45
+    139, // dist along axis = 46
+    138, // dist along axis = 47
+    138, // dist along axis = 48
+    138, // dist along axis = 49
+    137, // dist along axis = 50
+    137, // dist along axis = 51
+    136, // dist along axis = 52
+    136, // dist along axis = 53
+    136, // dist along axis = 54
+    135, // dist along axis = 55
+    135, // dist along axis = 56
+    134, // dist along axis = 57
+    134, // dist along axis = 58
+    134, // dist along axis = 59
+    133, // dist along axis = 60
+    133, // dist along axis = 61
+    132, // dist along axis = 62
+    132, // dist along axis = 63
+    131, // dist along axis = 64
+    131, // dist along axis = 65
+    130, // dist along axis = 66
+    130, // dist along axis = 67
+    129, // dist along axis = 68
+    129, // dist along axis = 69
+    128, // dist along axis = 70
+    128, // dist along axis = 71
     127, // dist along axis = 72
     126, // dist along axis = 73
     126, // dist along axis = 74
@@ -2,80 +2,80 @@
 #include "chordVec.h"
 
 const unsigned char chordVec147[148] = {
-    -109, // dist along axis = 0
-    -109, // dist along axis = 1
-    -109, // dist along axis = 2
-    -109, // dist along axis = 3
-    -109, // dist along axis = 4
-    -109, // dist along axis = 5
-    -109, // dist along axis = 6
-    -109, // dist along axis = 7
-    -109, // dist along axis = 8
-    -109, // dist along axis = 9
-    -109, // dist along axis = 10
-    -109, // dist along axis = 11
-    -109, // dist along axis = 12
-    -110, // dist along axis = 13
-    -110, // dist along axis = 14
-    -110, // dist along axis = 15
-    -110, // dist along axis = 16
-    -110, // dist along axis = 17
-    -110, // dist along axis = 18
-    -110, // dist along axis = 19
-    -110, // dist along axis = 20
-    -111, // dist along axis = 21
-    -111, // dist along axis = 22
-    -111, // dist along axis = 23
-    -111, // dist along axis = 24
-    -111, // dist along axis = 25
-    -111, // dist along axis = 26
-    -112, // dist along axis = 27
-    -112, // dist along axis = 28
-    -112, // dist along axis = 29
-    -112, // dist along axis = 30
-    -112, // dist along axis = 31
-    -113, // dist along axis = 32
-    -113, // dist along axis = 33
-    -113, // dist along axis = 34
-    -113, // dist along axis = 35
-    -113, // dist along axis = 36
-    -114, // dist along axis = 37
-    -114, // dist along axis = 38
-    -114, // dist along axis = 39
-    -115, // dist along axis = 40
-    -115, // dist along axis = 41
-    -115, // dist along axis = 42
-    -115, // dist along axis = 43
-    -116, // dist along axis = 44
-    -116, // dist along axis = 45
-    -116, // dist along axis = 46
-    -117, // dist along axis = 47
-    -117, // dist along axis = 48
-    -117, // dist along axis = 49
-    -118, // dist along axis = 50
-    -118, // dist along axis = 51
-    -119, // dist along axis = 52
-    -119, // dist along axis = 53
-    -119, // dist along axis = 54
-    -120, // dist along axis = 55
-    -120, // dist along axis = 56
-    -121, // dist along axis = 57
-    -121, // dist along axis = 58
-    -121, // dist along axis = 59
-    -122, // dist along axis = 60
-    -122, // dist along axis = 61
-    -123, // dist along axis = 62
-    -123, // dist along axis = 63
-    -124, // dist along axis = 64
-    -124, // dist along axis = 65
-    -125, // dist along axis = 66
-    -125, // dist along axis = 67
-    -126, // dist along axis = 68
-    -126, // dist along axis = 69
-    -127, // dist along axis = 70
-    -127, // dist along axis = 71
-    -128, // dist along axis = 72
-    -128, // dist along axis = 73
+    147, // dist along axis = 0
+    147, // dist along axis = 1
+    147, // dist along axis = 2
+    147, // dist along axis = 3
+    147, // dist along axis = 4
+    147, // dist along axis = 5
+    147, // dist along axis = 6
+    147, // dist along axis = 7
+    147, // dist along axis = 8
+    147, // dist along axis = 9
+    147, // dist along axis = 10
+    147, // dist along axis = 11
+    147, // dist along axis = 12
+    146, // dist along axis = 13
+    146, // dist along axis = 14
+    146, // dist along axis = 15
+    146, // dist along axis = 16
+    146, // dist along axis = 17
+    146, // dist along axis = 18
+    146, // dist along axis = 19
+    146, // dist along axis = 20
+    145, // dist along axis = 21
+    145, // dist along axis = 22
+    145, // dist along axis = 23
+    145, // dist along axis = 24
+    145, // dist along axis = 25
+    145, // dist along axis = 26
+    144, // dist along axis = 27
+    144, // dist along axis = 28
+    144, // dist along axis = 29
+    144, // dist along axis = 30
+    144, // dist along axis = 31
+    143, // dist along axis = 32
+    143, // dist along axis = 33
+    143, // dist along axis = 34
+    143, // dist along axis = 35
+    143, // dist along axis = 36
+    142, // dist along axis = 37
+    142, // dist along axis = 38
+    142, // dist along axis = 39
+    141, // dist along axis = 40
+    141, // dist along axis = 41
+    141, // dist along axis = 42
+    141, // dist along axis = 43
+    140, // dist along axis = 44
+    140, // dist along axis = 45
+    140, // dist along axis = 46
+    139, // dist along axis = 47
+    139, // dist along axis = 48
+    139, // dist along axis = 49
+    138, // dist along axis = 50
+    138, // dist along axis = 51
+    137, // dist along axis = 52
+    137, // dist along axis = 53
+    137, // dist along axis = 54
+    136, // dist along axis = 55
+    136, // dist along axis = 56
+    135, // dist along axis = 57
+    135, // dist along axis = 58
+    135, // dist along axis = 59
+    134, // dist along axis = 60
+    134, // dist along axis = 61
+    133, // dist along axis = 62
+    133, // dist along axis = 63
+    132, // dist along axis = 64
+    132, // dist along axis = 65
+    131, // dist along axis = 66
+    131, // dist along axis = 67
+    130, // dist along axis = 68
+    130, // dist along axis = 69
+    129, // dist along axis = 70
+    129, // dist along axis = 71
+    128, // dist along axis = 72
+    128, // dist along axis = 73
     127, // dist along axis = 74
     126, // dist along axis = 75
     126, // dist along axis = 76
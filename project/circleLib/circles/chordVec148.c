@@ -2,82 +2,82 @@
 #include "chordVec.h"
 
 const unsigned char chordVec148[149] = {
-    -108, // dist along axis = 0
-    -108, // dist along axis = 1
-    -108, // dist along axis = 2
-    -108, // dist along axis = 3
-    -108, // dist along axis = 4
-    -108, // dist along axis = 5
-    -108, // dist along axis = 6
-    -108, // dist along axis = 7
-    -108, // dist along axis = 8
-    -108, // dist along axis = 9
-    -108, // dist along axis = 10
-    -108, // dist along axis = 11
-    -108, // dist along axis = 12
-    -109, // dist along axis = 13
-    -109, // dist along axis = 14
-    -109, // dist along axis = 15
-    -109, // dist along axis = 16
-    -109, // dist along axis = 17
-    -109, // dist along axis = 18
-    -109, // dist along axis = 19
-    -109, // dist along axis = 20
-    -109, // dist along axis = 21
-    -110, // dist along axis = 22
-    -110, // dist along axis = 23
-    -110, // dist along axis = 24
-    -110, // dist along axis = 25
-    -110, // dist along axis = 26
-    -110, // dist along axis = 27
-    -111, // dist along axis = 28
-    -111, // dist along axis = 29
-    -111, // dist along axis = 30
-    -111, // dist along axis = 31
-    -112, // dist along axis = 32
-    -112, // dist along axis = 33
-    -112, // dist along axis = 34
-    -112, // dist along axis = 35
-    -112, // dist along axis = 36
-    -113, // dist along axis = 37
-    -113, // dist along axis = 38
-    -113, // dist along axis = 39
-    -114, // dist along axis = 40
-    -114, // dist along axis = 41
-    -114, // dist along axis = 42
-    -114, // dist along axis = 43
-    -115, // dist along axis = 44
-    -115, // dist along axis = 45
-    -115, // dist along axis = 46
-    -116, // dist along axis = 47
-    -116, // dist along axis = 48
-    -116, // dist along axis = 49
-    -117, // dist along axis = 50
-    -117, // dist along axis = 51
-    -117, // dist along axis = 52
-    -118, // dist along axis = 53
-    -118, // dist along axis = 54
-    -119, // dist along axis = 55
-    -119, // dist along axis = 56
-    -119, // dist along axis = 57
-    -120, // dist along axis = 58
-    -120, // dist along axis = 59
-    -121, // dist along axis = 60
-    -121, // dist along axis = 61
-    -122, // dist along axis = 62
-    -122, // dist along axis = 63
-    -123, // dist along axis = 64
-    -123, // dist along axis = 65
-    -124, // dist along axis = 66
-    -124, // dist along axis = 67
-    -125, // dist along axis = 68
-    -125, // dist along axis = 69
-    -126, // dist along axis = 70
-    -126, // dist along axis = 71
-    -127, // dist along axis = 72
-    -127, // dist along axis = 73
-    -128, // dist along axis = 74
-    -128, // dist along axis = 75
+    148, // dist along axis = 0
+    148, // dist along axis = 1
+    148, // dist along axis = 2
+    148, // dist along axis = 3
+    148, // dist along axis = 4
+    148, // dist along axis = 5
+    148, // dist along axis = 6
+    148, // dist along axis = 7
+    148, // dist along axis = 8
+    148, // dist along axis = 9
+    148, // dist along axis = 10
+    148, // dist along axis = 11
+    148, // dist along axis = 12
+    147, // dist along axis = 13
+    147, // dist along axis = 14
+    147, // dist along axis = 15
+    147, // dist along axis = 16
+    147, // dist along axis = 17
+    147, // dist along axis = 18
+    147, // dist along axis = 19
+    147, // dist along axis = 20
+    147, // dist along axis = 21
+    146, // dist along axis = 22
+    146, // dist along axis = 23
+    146, // dist along axis = 24
+    146, // dist along axis = 25
+    146, // dist along axis = 26
+    146, // dist along axis = 27
+    145, // dist along axis = 28
+    145, // dist along axis = 29
+    145, // dist along axis = 30
+    145, // dist along axis = 31
+    144, // dist along axis = 32
+    144, // dist along axis = 33
+    144, // dist along axis = 34
+    144, // dist along axis = 35
+    144, // dist along axis = 36
+    143, // dist along axis = 37
+    143, // dist along axis = 38
+    143, // dist along axis = 39
+    142, // dist along axis = 40
+    142, // dist along axis = 41
+    142, // dist along axis = 42
+    142, // dist along axis = 43
+    141, // dist along axis = 44
+    141, // dist along axis = 45
+    141, // dist along axis = 46
+    140, // dist along axis = 47
+    140, // dist along axis = 48
+    140, // dist along axis = 49
+    139, // dist along axis = 50
+    139, // dist along axis = 51
+    139, // dist along axis = 52
+    138, // dist along axis = 53
+    138, // dist along axis = 54
+    137, // dist along axis = 55
+    137, // dist along axis = 56
+    137, // dist along axis = 57
+    136, // dist along axis = 58
+    136, // dist along axis = 59
+    135, // dist along axis = 60
+    135, // dist along axis = 61
+    134, // dist along axis = 62
+    134, // dist along axis = 63
+    133, // dist along axis = 64
+    133, // dist along axis = 65
+    132, // dist along axis = 66
+    132, // dist along axis = 67
+    131, // dist along axis = 68
+    131, // dist along axis = 69
+    130, // dist along axis = 70
+    130, // dist along axis = 71
+    129, // dist along axis = 72
+    129, // dist along axis = 73
+    128, // dist along axis = 74
+    128, // dist along axis = 75
     127, // dist along axis = 76
     126, // dist along axis = 77
     126, // dist along axis = 78
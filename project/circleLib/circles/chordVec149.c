@@ -2,84 +2,84 @@
 #include "chordVec.h"
 
 const unsigned char chordVec149[150] = {
-    -107, // dist along axis = 0
-    -107, // dist along axis = 1
-    -107, // dist along axis = 2
-    -107, // dist along axis = 3
-    -107, // dist along axis = 4
-    -107, // dist along axis = 5
-    -107, // dist along axis = 6
-    -107, // dist along axis = 7
-    -107, // dist along axis = 8
-    -107, // dist along axis = 9
-    -107, // dist along axis = 10
-    -107, // dist along axis = 11
-    -107, // dist along axis = 12
-    -108, // dist along axis = 13
-    -108, // dist along axis = 14
-    -108, // dist along axis = 15
-    -108, // dist along axis = 16
-    -108, // dist along axis = 17
-    -108, // dist along axis = 18
-    -108, // dist along axis = 19
-    -108, // dist along axis = 20
-    -108, // dist along axis = 21
-    -109, // dist along axis = 22
-    -109, // dist along axis = 23
-    -109, // dist along axis = 24
-    -109, // dist along axis = 25
-    -109, // dist along axis = 26
-    -109, // dist along axis = 27
-    -110, // dist along axis = 28
-    -110, // dist along axis = 29
-    -110, // dist along axis = 30
-    -110, // dist along axis = 31
-    -110, // dist along axis = 32
-    -111, // dist along axis = 33
-    -111, // dist along axis = 34
-    -111, // dist along axis = 35
-    -111, // dist along axis = 36
-    -112, // dist along axis = 37
-    -112, // dist along axis = 38
-    -112, // dist along axis = 39
-    -112, // dist along axis = 40
-    -113, // dist along axis = 41
-    -113, // dist along axis = 42
-    -113, // dist along axis = 43
-    -114, // dist along axis = 44
-    -114, // dist along axis = 45
-    -114, // dist along axis = 46
-    -115, // dist along axis = 47
-    -115, // dist along axis = 48
-    -115, // dist along axis = 49
-    -116, // dist along axis = 50
-    -116, // dist along axis = 51
-    -116, // dist along axis = 52
-    -117, // dist along axis = 53
-    -117, // dist along axis = 54
-    -118, // dist along axis = 55
-    -118, // dist along axis = 56
-    -118, // dist along axis = 57
-    -119, // dist along axis = 58
-    -119, // dist along axis = 59
-    -120, // dist along axis = 60
-    -120, // dist along axis = 61
-    -121, // dist along axis = 62
-    -121, // dist along axis = 63
-    -121, // dist along axis = 64
-    -122, // dist along axis = 65
-    -122, // dist along axis = 66
-    -123, // dist along axis = 67
-    -123, // dist along axis = 68
-    -124, // dist along axis = 69
-    -124, // dist along axis = 70
-    -125, // dist along axis = 71
-    -126, // dist along axis = 72
-    -126, // dist along axis = 73
-    -127, // dist along axis = 74
-    -127, // dist along axis = 75
-    -128, // dist along axis = 76
-    -128, // dist along axis = 77
+    149, // dist along axis = 0
+    149, // dist along axis = 1
+    149, // dist along axis = 2
+    149, // dist along axis = 3
+    149, // dist along axis = 4
+    149, // dist along axis = 5
+    149, // dist along axis = 6
+    149, // dist along axis = 7
+    149, // dist along axis = 8
+    149, // dist along axis = 9
+    149, // dist along axis = 10
+    149, // dist along axis = 11
+    149, // dist along axis = 12
+    148, // dist along axis = 13
+    148, // dist along axis = 14
+    148, // dist along axis = 15
+    148, // dist along axis = 16
+    148, // dist along axis = 17
+    148, // dist along axis = 18
+    148, // dist along axis = 19
+    148, // dist along axis = 20
+    148, // dist along axis = 21
+    147, // dist along axis = 22
+    147, // dist along axis = 23
+    147, // dist along axis = 24
+    147, // dist along axis = 25
+    147, // dist along axis = 26
+    147, // dist along axis = 27
+    146, // dist along axis = 28
+    146, // dist along axis = 29
+    146, // dist along axis = 30
+    146, // dist along axis = 31
+    146, // dist along axis = 32
+    145, // dist along axis = 33
+    145, // dist along axis = 34
+    145, // dist along axis = 35
+    145, // dist along axis = 36
+    144, // dist along axis = 37
+    144, // dist along axis = 38
+    144, // dist along axis = 39
+    144, // dist along axis = 40
+    143, // dist along axis = 41
+    143, // dist along axis = 42
+    143, // dist along axis = 43
+    142, // dist along axis = 44
+    142, // dist along axis = 45
+    142, // dist along axis = 46
+    141, // dist along axis = 47
+    141, // dist along axis = 48
+    141, // dist along axis = 49
+    140, // dist along axis = 50
+    140, // dist along axis = 51
+    140, // dist along axis = 52
+    139, // dist along axis = 53
+    139, // dist along axis = 54
+    138, // dist along axis = 55
+    138, // dist along axis = 56
+    138, // dist along axis = 57
+    137, // dist along axis = 58
+    137, // dist along axis = 59
+    136, // dist along axis = 60
+    136, // dist along axis = 61
+    135, // dist along axis = 62
+    135, // dist along axis = 63
+    135, // dist along axis = 64
+    134, // dist along axis = 65
+    134, // dist along axis = 66
+    133, // dist along axis = 67
+    133, // dist along axis = 68
+    132, // dist along axis = 69
+    132, // dist along axis = 70
+    131, // dist along axis = 71
+    130, // dist along axis = 72
+    130, // dist along axis = 73
+    129, // dist along axis = 74
+    129, // dist along axis = 75
+    128, // dist along axis = 76
+    128, // dist along axis = 77
     127, // dist along axis = 78
     126, // dist along axis = 79
     126, // dist along axis = 80
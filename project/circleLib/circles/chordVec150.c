@@ -2,86 +2,86 @@
 #include "chordVec.h"
 
 const unsigned char chordVec150[151] = {
-    -106, // dist along axis = 0
-    -106, // dist along axis = 1
-    -106, // dist along axis = 2
-    -106, // dist along axis = 3
-    -106, // dist along axis = 4
-    -106, // dist along axis = 5
-    -106, // dist along axis = 6
-    -106, // dist along axis = 7
-    -106, // dist along axis = 8
-    -106, // dist along axis = 9
-    -106, // dist along axis = 10
-    -106, // dist along axis = 11
-    -106, // dist along axis = 12
-    -107, // dist along axis = 13
-    -107, // dist along axis = 14
-    -107, // dist along axis = 15
-    -107, // dist along axis = 16
-    -107, // dist along axis = 17
-    -107, // dist along axis = 18
-    -107, // dist along axis = 19
-    -107, // dist along axis = 20
-    -107, // dist along axis = 21
-    -108, // dist along axis = 22
-    -108, // dist along axis = 23
-    -108, // dist along axis = 24
-    -108, // dist along axis = 25
-    -108, // dist along axis = 26
-    -108, // dist along axis = 27
-    -109, // dist along axis = 28
-    -109, // dist along axis = 29
-    -109, // dist along axis = 30
-    -109, // dist along axis = 31
-    -109, // dist along axis = 32
-    -110, // dist along axis = 33
-    -110, // dist along axis = 34
-    -110, // dist along axis = 35
-    -110, // dist along axis = 36
-    -111, // dist along axis = 37
-    -111, // dist along axis = 38
-    -111, // dist along axis = 39
-    -111, // dist along axis = 40
-    -112, // dist along axis = 41
-    -112, // dist along axis = 42
-    -112, // dist along axis = 43
-    -113, // dist along axis = 44
-    -113, // dist along axis = 45
-    -113, // dist along axis = 46
-    -114, // dist along axis = 47
-    -114, // dist along axis = 48
-    -114, // dist along axis = 49
-    -115, // dist along axis = 50
-    -115, // dist along axis = 51
-    -115, // dist along axis = 52
-    -116, // dist along axis = 53
-    -116, // dist along axis = 54
-    -116, // dist along axis = 55
-    -117, // dist along axis = 56
-    -117, // dist along axis = 57
-    -118, // dist along axis = 58
-    -118, // dist along axis = 59
-    -119, // dist along axis = 60
-    -119, // dist along axis = 61
-    -119, // dist along axis = 62
-    -120, // dist along axis = 63
-    -120, // dist along axis = 64
-    -121, // dist along axis = 65
-    -121, // dist along axis = 66
-    -122, // dist along axis = 67
-    -122, // dist along axis = 68
-    -123, // dist along axis = 69
-    -123, // dist along axis = 70
-    -124, // dist along axis = 71
-    -124, // dist along axis = 72
-    -125, // dist along axis = 73
-    -126, // dist along axis = 74
-    -126, // dist along axis = 75
-    -127, // dist along axis = 76
-    -127, // dist along axis = 77
-    -128, // dist along axis = 78
-    -128, // dist along axis = 79
+    150, // dist along axis = 0
+    150, // dist along axis = 1
+    150, // dist along axis = 2
+    150, // dist along axis = 3
+    150, // dist along axis = 4
+    150, // dist along axis = 5
+    150, // dist along axis = 6
+    150, // dist along axis = 7
+    150, // dist along axis = 8
+    150, // dist along axis = 9
+    150, // dist along axis = 10
+    150, // dist along axis = 11
+    150, // dist along axis = 12
+    149, // dist along axis = 13
+    149, // dist along axis = 14
+    149, // dist along axis = 15
+    149, // dist along axis = 16
+    149, // dist along axis = 17
+    149, // dist along axis = 18
+    149, // dist along axis = 19
+    149, // dist along axis = 20
+    149, // dist along axis = 21
+    148, // dist along axis = 22
+    148, // dist along axis = 23
+    148, // dist along axis = 24
+    148, // dist along axis = 25
+    148, // dist along axis = 26
+    148, // dist along axis = 27
+    147, // dist along axis = 28
+    147, // dist along axis = 29
+    147, // dist along axis = 30
+    147, // dist along axis = 31
+    147, // dist along axis = 32
+    146, // dist along axis = 33
+    146, // dist along axis = 34
+    146, // dist along axis = 35
+    146, // dist along axis = 36
+    145, // dist along axis = 37
+    145, // dist along axis = 38
+    145, // dist along axis = 39
+    145, // dist along axis = 40
+    144, // dist along axis = 41
+    144, // dist along axis = 42
+    144, // dist along axis = 43
+    143, // dist along axis = 44
+    143, // dist along axis = 45
+    143, // dist along axis = 46
+    142, // dist along axis = 47
+    142, // dist along axis = 48
+    142, // dist along axis = 49
+    141, // dist along axis = 50
+    141, // dist along axis = 51
+    141, // dist along axis = 52
+    140, // dist along axis = 53
+    140, // dist along axis = 54
+    140, // dist along axis = 55
+    139, // dist along axis = 56
+    139, // dist along axis = 57
+    138, // dist along axis = 58
+    138, // dist along axis = 59
+    137, // dist along axis = 60
+    137, // dist along axis = 61
+    137, // dist along axis = 62
+    136, // dist along axis = 63
+    136, // dist along axis = 64
+    135, // dist along axis = 65
+    135, // dist along axis = 66
+    134, // dist along axis = 67
+    134, // dist along axis = 68
+    133, // dist along axis = 69
+    133, // dist along axis = 70
+    132, // dist along axis = 71
+    132, // dist along axis = 72
+    131, // dist along axis = 73
+    130, // dist along axis = 74
+    130, // dist along axis = 75
+    129, // dist along axis = 76
+    129, // dist along axis = 77
+    128, // dist along axis = 78
+    128, // dist along axis = 79
     127, // dist along axis = 80
     126, // dist along axis = 81
     126, // dist along axis = 82
@@ -0,0 +1,27 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "chordVec.h"
+
+const unsigned char ellipseVec10x20[21] = {
+    10, // dist along row axis = 0
+    10, // dist along row axis = 1
+    10, // dist along row axis = 2
+    10, // dist along row axis = 3
+    10, // dist along row axis = 4
+    10, // dist along row axis = 5
+    10, // dist along row axis = 6
+    9, // dist along row axis = 7
+    9, // dist along row axis = 8
+    9, // dist along row axis = 9
+    9, // dist along row axis = 10
+    8, // dist along row axis = 11
+    8, // dist along row axis = 12
+    8, // dist along row axis = 13
+    7, // dist along row axis = 14
+    7, // dist along row axis = 15
+    6, // dist along row axis = 16
+    5, // dist along row axis = 17
+    5, // dist along row axis = 18
+    3, // dist along row axis = 19
+    2, // dist along row axis = 20
+};
+
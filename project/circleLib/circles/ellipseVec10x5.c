@@ -0,0 +1,12 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "chordVec.h"
+
+const unsigned char ellipseVec10x5[6] = {
+    10, // dist along row axis = 0
+    10, // dist along row axis = 1
+    9, // dist along row axis = 2
+    8, // dist along row axis = 3
+    7, // dist along row axis = 4
+    4, // dist along row axis = 5
+};
+
@@ -0,0 +1,17 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "chordVec.h"
+
+const unsigned char ellipseVec20x10[11] = {
+    20, // dist along row axis = 0
+    20, // dist along row axis = 1
+    20, // dist along row axis = 2
+    19, // dist along row axis = 3
+    18, // dist along row axis = 4
+    18, // dist along row axis = 5
+    16, // dist along row axis = 6
+    15, // dist along row axis = 7
+    13, // dist along row axis = 8
+    10, // dist along row axis = 9
+    6, // dist along row axis = 10
+};
+
@@ -0,0 +1,22 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "chordVec.h"
+
+const unsigned char ellipseVec30x15[16] = {
+    30, // dist along row axis = 0
+    30, // dist along row axis = 1
+    30, // dist along row axis = 2
+    29, // dist along row axis = 3
+    29, // dist along row axis = 4
+    28, // dist along row axis = 5
+    28, // dist along row axis = 6
+    27, // dist along row axis = 7
+    26, // dist along row axis = 8
+    24, // dist along row axis = 9
+    23, // dist along row axis = 10
+    21, // dist along row axis = 11
+    19, // dist along row axis = 12
+    16, // dist along row axis = 13
+    13, // dist along row axis = 14
+    7, // dist along row axis = 15
+};
+
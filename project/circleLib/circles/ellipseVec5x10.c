@@ -0,0 +1,17 @@
+// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016
+#include "chordVec.h"
+
+const unsigned char ellipseVec5x10[11] = {
+    5, // dist along row axis = 0
+    5, // dist along row axis = 1
+    5, // dist along row axis = 2
+    5, // dist along row axis = 3
+    5, // dist along row axis = 4
+    4, // dist along row axis = 5
+    4, // dist along row axis = 6
+    4, // dist along row axis = 7
+    3, // dist along row axis = 8
+    2, // dist along row axis = 9
+    1, // dist along row axis = 10
+};
+
@@ -1,50 +1,54 @@
 
-///////////////////////////////////////////
-// build table chordVec[d] of circle 1/2 widths at distances d from center
-// Code adapted from RobG's EduKit
-// Uses Bresenham's circle algorithm
-// Modified from RobG's EduKit by Eric Freudenthal and David Pruitt 2016
-///////////////////////////////////////////
-void computeChordVec(unsigned char chordVec[], unsigned char radius) 
-{
-  int col = radius, row = 0;	/* first coordinate (radius, 0) */
-  
-  // key insight: (col+1)**2 - col**2 = 2col+1
-  
-  int dColSquared = 2 * col - 1;  // change in col**2 for a unit decrease in col
-  int dRowSquared = 1;	    // change in row**2 for a unit increase in row
-
-  int radiusSqErr = 0;		/* (radius, 0) is on the circle  */
-  int colPrev = 0;		/* initially bogus value  to force first entry*/
-  while (col >= row) {		/* only sweep first octant */
-    chordVec[row] = col;      /* row always changes in first octant */
-
-    /* mirror into 2nd octant */
-    if (colPrev != col)		/* col sometimes repeats in first octant */
-      chordVec[col] = row;	/* only save first (max) col for row */
-    colPrev = col;
-
-    row++;			/* move vertically (slope <= -1 for first octant) */
-    radiusSqErr += dRowSquared;	/* current radiusSqErr */
-    dRowSquared += 2; 		/* next dRowSquared */
-    if ((2 * radiusSqErr) > dColSquared) { /* only update col if error reduced */
-      col--;			/* move horizontally */
-      radiusSqErr -= dColSquared;	/* current radiusSqErr */
-      dColSquared -= 2;	      /* next dColSquared */
-    }
-  }
-}
-
 #include "stdio.h"
 #include "assert.h"
+#include "stdlib.h"
+
+/* defined in computeChordVec.c (also linked into libCircle) */
+void computeChordVec(unsigned char chordVec[], unsigned char radius);
 
 
+// 1/2 widths of rows of an ellipse with radii rx (cols) and ry (rows).
+// Like incremental circles, a pixel is inside when it is within
+// the ellipse with radii rx+1/2, ry+1/2.
+void computeEllipseVec(unsigned char ellipseVec[], int rx, int ry)
+{
+  long long a = 2 * rx + 1, b = 2 * ry + 1; /* doubled radii */
+  int row;
+  for (row = 0; row <= ry; row++) {
+    int col = 0;		/* (2col)**2 b**2 + (2row)**2 a**2 <= a**2 b**2 */
+    while (4 * (col+1) * (col+1) * b * b + 4LL * row * row * a * a <= a * a * b * b)
+      col++;
+    ellipseVec[row] = col;
+  }
+}
+
 // Generate circles as source files
 // (c) Eric Freudenthal, 2016
-int main()
+//
+// Usage: makeCircles [radius | RXxRY | OUTER/INNER ...]
+//   radius:      generated in incremental mode (no chord table)
+//   RXxRY:       generate ellipseVecRXxRY and AbEllipse ellipseRXxRY
+//   OUTER/INNER: generate AbRing ringOUTER_INNER from two circles' chordVecs
+int main(int argc, char **argv)
 {
-  int radius;
-  char chordVec[151];
+  int radius, arg;
+  unsigned char chordVec[151];
+  char incremental[151] = {0};
+  int ellipses[20][2], rings[20][2], numEllipses = 0, numRings = 0;
+  for (arg = 1; arg < argc; arg++) {
+    int a, b;
+    if (sscanf(argv[arg], "%dx%d", &a, &b) == 2) {
+      assert(numEllipses < 20 && a >= 1 && a <= 150 && b >= 1 && b <= 150);
+      ellipses[numEllipses][0] = a; ellipses[numEllipses++][1] = b;
+    } else if (sscanf(argv[arg], "%d/%d", &a, &b) == 2) {
+      assert(numRings < 20 && a > b && b >= 2 && a <= 150);
+      rings[numRings][0] = a; rings[numRings++][1] = b;
+    } else {
+      int r = atoi(argv[arg]);
+      assert(r >= 2 && r <= 150);
+      incremental[r] = 1;
+    }
+  }
   FILE *circleIncludeFile = fopen("abCircle_decls.h", "w");
   FILE *chordIncludeFile = fopen("chordVec.h", "w");
   assert(chordIncludeFile); assert(circleIncludeFile);
@@ -61,7 +65,7 @@ int main()
     
     computeChordVec(chordVec, radius);
 
-    {				/* chordVecN.c */
+    if (!incremental[radius]) {	/* chordVecN.c */
       sprintf(filename, "circles/chordVec%d.c", radius);
       FILE *fp = fopen(filename, "w");
       assert(fp);
@@ -80,15 +84,68 @@ int main()
       fprintf(fp, "#include \"abCircle.h\"\n\n");
       fprintf(fp, "#include \"chordVec.h\"\n\n");
       fprintf(fp, "const AbCircle circle%d = {" , radius);
-      fprintf(fp, "  abCircleGetBounds, abCircleCheck, chordVec%d, %d", radius, radius);
+      if (incremental[radius])
+	fprintf(fp, "  abCircleGetBounds, abCircleIncCheck, 0, %d", radius);
+      else
+	fprintf(fp, "  abCircleGetBounds, abCircleCheck, chordVec%d, %d", radius, radius);
       fprintf(fp, "};\n");
       fclose(fp);
     }
     				/* includes */
-    fprintf(chordIncludeFile, "extern const unsigned char chordVec%d[%d];\n", radius, radius+1);
+    if (!incremental[radius])
+      fprintf(chordIncludeFile, "extern const unsigned char chordVec%d[%d];\n", radius, radius+1);
     fprintf(circleIncludeFile, "extern const AbCircle circle%d;\n" , radius);
   }
 
+  for (arg = 0; arg < numEllipses; arg++) {
+    char filename[100];
+    int rx = ellipses[arg][0], ry = ellipses[arg][1], row;
+    computeEllipseVec(chordVec, rx, ry);
+    {				/* ellipseVecRXxRY.c */
+      sprintf(filename, "circles/ellipseVec%dx%d.c", rx, ry);
+      FILE *fp = fopen(filename, "w");
+      assert(fp);
+      fprintf(fp, "// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016\n");
+      fprintf(fp, "#include \"chordVec.h\"\n\n");
+      fprintf(fp, "const unsigned char ellipseVec%dx%d[%d] = {\n", rx, ry, ry+1);
+      for (row = 0; row <= ry; row ++) 
+	fprintf(fp, "    %d, // dist along row axis = %d\n", chordVec[row], row);
+      fprintf(fp, "};\n\n");
+      fclose(fp);
+    } {				/* abEllipseRXxRY.c */
+      sprintf(filename, "circles/abEllipse%dx%d.c", rx, ry);
+      FILE *fp = fopen(filename, "w");
+      assert(fp);
+      fprintf(fp, "// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016\n");
+      fprintf(fp, "#include \"abCircle.h\"\n\n");
+      fprintf(fp, "#include \"chordVec.h\"\n\n");
+      fprintf(fp, "const AbEllipse ellipse%dx%d = {" , rx, ry);
+      fprintf(fp, "  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, ellipseVec%dx%d, 0, %d, 0", rx, ry, ry);
+      fprintf(fp, "};\n");
+      fclose(fp);
+    }
+    fprintf(chordIncludeFile, "extern const unsigned char ellipseVec%dx%d[%d];\n", rx, ry, ry+1);
+    fprintf(circleIncludeFile, "extern const AbEllipse ellipse%dx%d;\n" , rx, ry);
+  }
+
+  for (arg = 0; arg < numRings; arg++) { /* abRingO_I.c */
+    char filename[100];
+    int outer = rings[arg][0], inner = rings[arg][1];
+    assert(!incremental[outer] && !incremental[inner]); /* need both chordVecs */
+    sprintf(filename, "circles/abRing%d_%d.c", outer, inner);
+    FILE *fp = fopen(filename, "w");
+    assert(fp);
+    fprintf(fp, "// Automatically generated by makeCircles.  (c) Eric Freudenthal, 2016\n");
+    fprintf(fp, "#include \"abCircle.h\"\n\n");
+    fprintf(fp, "#include \"chordVec.h\"\n\n");
+    fprintf(fp, "const AbRing ring%d_%d = {" , outer, inner);
+    fprintf(fp, "  abEllipseGetBounds, abEllipseCheck, abEllipseGetSpans, chordVec%d, chordVec%d, %d, %d",
+	    outer, inner, outer, inner);
+    fprintf(fp, "};\n");
+    fclose(fp);
+    fprintf(circleIncludeFile, "extern const AbRing ring%d_%d;\n" , outer, inner);
+  }
+
   fprintf(circleIncludeFile, "\n#endif // included \n");
   fprintf(chordIncludeFile, "\n#endif // included \n");
   fclose(chordIncludeFile);
@@ -151,5 +151,10 @@ extern const unsigned char chordVec147[148];
 extern const unsigned char chordVec148[149];
 extern const unsigned char chordVec149[150];
 extern const unsigned char chordVec150[151];
+extern const unsigned char ellipseVec10x5[6];
+extern const unsigned char ellipseVec20x10[11];
+extern const unsigned char ellipseVec30x15[16];
+extern const unsigned char ellipseVec5x10[11];
+extern const unsigned char ellipseVec10x20[21];
 
 #endif // included 
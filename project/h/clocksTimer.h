@@ -4,5 +4,7 @@
 void configureClocks();
 void enableWDTInterrupts();
 void timerAUpmode();
+void timerA1Continuous();
+unsigned int timerA1Read();	/* ticks of timerA1Continuous, wraps every 262ms */
 
 #endif
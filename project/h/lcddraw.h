@@ -13,6 +13,25 @@
  */
 void drawPixel(u_char col, u_char row, u_int colorBGR);
 
+/** A pixel to plot with plotPoints */
+typedef struct {
+  u_char col, row;
+  u_int colorBGR;
+} PlotPoint;
+
+/** Draw many single pixels at once
+ *
+ *  Sorts points (in place) by row, then column, and sends each run of
+ *  horizontally adjacent points through one window; runs on the same row
+ *  as the run before don't resend the row range.  If a pixel appears twice, the
+ *  later point wins.  The sort is an insertion sort, so it is quickest
+ *  when points are nearly in order already (as frame-to-frame effects are).
+ *
+ *  \param points The points (reordered)
+ *  \param count Number of points
+ */
+void plotPoints(PlotPoint *points, u_int count);
+
 /** Fill rectangle
  *
  *  \param colMin Column start
@@ -60,6 +79,30 @@ void drawChar5x7(u_char col, u_char row, char c,
  */
 void drawRectOutline(u_char colMin, u_char rowMin, u_char width, u_char height,
 		     u_int colorBGR);
+/** Draw line from col0,row0 to col1,row1 (both ends included)
+ *
+ *  Bresenham's algorithm, but each horizontal (or, for steep lines,
+ *  vertical) run of pixels is sent through a single window.
+ *
+ *  \param colorBGR Color of line in BGR
+ */
+void drawLine(u_char col0, u_char row0, u_char col1, u_char row1, u_int colorBGR);
+
+/** Draw line thickness pixels wide (measured across its shorter axis)
+ *
+ *  Each run becomes one filled rectangle, clipped to the screen.
+ */
+void drawThickLine(u_char col0, u_char row0, u_char col1, u_char row1,
+		   u_char thickness, u_int colorBGR);
+
+/** Draw lines joining vertices in order
+ *
+ *  \param vertices col, row pairs: {col0, row0, col1, row1, ...}
+ *  \param numVertices Number of vertices (pairs)
+ *  \param colorBGR Color of lines in BGR
+ */
+void drawPolyline(const u_char vertices[], u_char numVertices, u_int colorBGR);
+
 #endif // included
 
 
@@ -0,0 +1,182 @@
+/** \file displaylist.c
+ *  \brief Recorded drawing (see displaylist.h)
+ */
+#include "lcdutils.h"
+#include "lcddraw.h"
+#include "displaylist.h"
+
+void
+dlInit(DisplayList *dl)
+{
+  dl->count = 0;
+  dl->pixelsRecorded = dl->pixelsWritten = 0;
+  dl->windows = 0;
+}
+
+/** Next free command (flushing if full), with its rectangle set */
+static DlCommand *
+dlAdd(DisplayList *dl, u_char kind, u_char col, u_char row, u_char width, u_char height)
+{
+  DlCommand *cmd;
+  if (dl->count == DL_MAX_COMMANDS)
+    dlFlush(dl);
+  cmd = &dl->commands[dl->count++];
+  cmd->kind = kind;
+  cmd->col = col; cmd->row = row;
+  cmd->width = width; cmd->height = height;
+  return cmd;
+}
+
+void
+dlFill(DisplayList *dl, u_char col, u_char row, u_char width, u_char height, 
+       u_int colorBGR)
+{
+  if (width && height)
+    dlAdd(dl, DL_FILL, col, row, width, height)->u.color.fg = colorBGR;
+}
+
+void
+dlChar5x7(DisplayList *dl, u_char col, u_char row, char c,
+	  u_int fgColorBGR, u_int bgColorBGR)
+{
+  DlCommand *cmd = dlAdd(dl, DL_CHAR, col, row, 5, 8);
+  cmd->c = c;
+  cmd->u.color.fg = fgColorBGR;
+  cmd->u.color.bg = bgColorBGR;
+}
+
+void
+dlString5x7(DisplayList *dl, u_char col, u_char row, const char *string,
+	    u_int fgColorBGR, u_int bgColorBGR)
+{
+  for (; *string; string++, col += 6)
+    dlChar5x7(dl, col, row, *string, fgColorBGR, bgColorBGR);
+}
+
+void
+dlArea(DisplayList *dl, u_char col, u_char row, u_char width, u_char height,
+       void (*draw)(const void *arg), const void *arg)
+{
+  if (width && height) {
+    DlCommand *cmd = dlAdd(dl, DL_AREA, col, row, width, height);
+    cmd->u.area.draw = draw;
+    cmd->u.area.arg = arg;
+  }
+}
+
+/** Do a's and b's rectangles share a pixel? */
+static int
+overlaps(const DlCommand *a, const DlCommand *b)
+{
+  return a->col < b->col + b->width && b->col < a->col + a->width &&
+    a->row < b->row + b->height && b->row < a->row + a->height;
+}
+
+/** Does outer's rectangle contain inner's? */
+static int
+covers(const DlCommand *outer, const DlCommand *inner)
+{
+  return outer->col <= inner->col && outer->row <= inner->row &&
+    outer->col + outer->width >= inner->col + inner->width &&
+    outer->row + outer->height >= inner->row + inner->height;
+}
+
+/** Does any live command strictly between first and last overlap cmd? */
+static int
+blocked(const DlCommand *first, const DlCommand *last, const DlCommand *cmd)
+{
+  for (first++; first < last; first++)
+    if (first->kind != DL_NONE && overlaps(first, cmd))
+      return 1;
+  return 0;
+}
+
+/** If fills a and b form one rectangle, grow b to it */
+static int
+mergeFills(const DlCommand *a, DlCommand *b)
+{
+  if (a->u.color.fg != b->u.color.fg)
+    return 0;
+  if (a->row == b->row && a->height == b->height &&
+      (a->col + a->width == b->col || b->col + b->width == a->col)) {
+    if (a->col < b->col)
+      b->col = a->col;
+    b->width += a->width;
+    return 1;
+  }
+  if (a->col == b->col && a->width == b->width &&
+      (a->row + a->height == b->row || b->row + b->height == a->row)) {
+    if (a->row < b->row)
+      b->row = a->row;
+    b->height += a->height;
+    return 1;
+  }
+  return 0;
+}
+
+void
+dlFlush(DisplayList *dl)
+{
+  DlCommand *cmds = dl->commands, *end = cmds + dl->count, *i, *j;
+  DlCommand tmp;
+
+  dl->pixelsRecorded = 0;
+  for (i = cmds; i < end; i++)
+    dl->pixelsRecorded += i->width * i->height;
+
+  /* cull: drop commands that later ones paint over completely */
+  for (i = cmds; i < end; i++)
+    for (j = i + 1; j < end; j++)
+      if (j->kind != DL_NONE && covers(j, i)) {
+	i->kind = DL_NONE;
+	break;
+      }
+
+  /* merge: fold a fill into a later touching fill of the same color,
+     unless something drawn in between overlaps it */
+  for (j = cmds; j < end; j++) {
+    if (j->kind != DL_FILL)
+      continue;
+    for (i = j - 1; i >= cmds; i--)
+      if (i->kind == DL_FILL && !blocked(i, j, i) && mergeFills(i, j)) {
+	i->kind = DL_NONE;
+	i = j;			/* j grew: look again */
+      }
+  }
+
+  /* sort top to bottom, left to right; a command never moves past one it overlaps */
+  for (j = cmds + 1; j < end; j++) {
+    for (i = j; i > cmds; i--) {
+      DlCommand *prev = i - 1;
+      if (i->kind == DL_NONE)
+	break;
+      if (prev->kind != DL_NONE) {
+	if (overlaps(prev, i) || prev->row < i->row || 
+	    (prev->row == i->row && prev->col <= i->col))
+	  break;
+      }
+      tmp = *prev; *prev = *i; *i = tmp;
+    }
+  }
+
+  dl->pixelsWritten = 0;
+  dl->windows = 0;
+  for (i = cmds; i < end; i++) {
+    switch (i->kind) {
+    case DL_FILL:
+      fillRectangle(i->col, i->row, i->width, i->height, i->u.color.fg);
+      break;
+    case DL_CHAR:
+      drawChar5x7(i->col, i->row, i->c, i->u.color.fg, i->u.color.bg);
+      break;
+    case DL_AREA:
+      (*i->u.area.draw)(i->u.area.arg);
+      break;
+    default:
+      continue;
+    }
+    dl->pixelsWritten += i->width * i->height;
+    dl->windows++;
+  }
+  dl->count = 0;
+}
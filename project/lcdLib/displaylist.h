@@ -0,0 +1,71 @@
+/** \file displaylist.h
+ *  \brief Recorded drawing: cull, merge and sort a frame's draws before sending them
+ */
+
+#ifndef displaylist_included
+#define displaylist_included
+
+#include "lcdutils.h"
+
+/** Commands a DisplayList holds (10 bytes of RAM each).  To change it,
+ *  build lcdLib and the program with the same -DDL_MAX_COMMANDS. */
+#ifndef DL_MAX_COMMANDS
+#define DL_MAX_COMMANDS 8
+#endif
+
+#define DL_NONE 0		/**< dropped */
+#define DL_FILL 1		/**< fillRectangle */
+#define DL_CHAR 2		/**< drawChar5x7 */
+#define DL_AREA 3		/**< application callback */
+
+/** One recorded draw.  Every command paints all pixels of its rectangle. */
+typedef struct {
+  u_char kind;
+  u_char col, row, width, height;
+  char c;			/**< DL_CHAR */
+  union {
+    struct { u_int fg, bg; } color; /**< DL_FILL (fg only), DL_CHAR */
+    struct { void (*draw)(const void *arg); const void *arg; } area; /**< DL_AREA */
+  } u;
+} DlCommand;
+
+/** A frame's worth of draws, applied in recording order by dlFlush */
+typedef struct {
+  DlCommand commands[DL_MAX_COMMANDS];
+  u_char count;
+  u_int pixelsRecorded;		/**< pixels the last flush's commands covered */
+  u_int pixelsWritten;		/**< pixels the last flush wrote */
+  u_char windows;		/**< windows the last flush opened */
+} DisplayList;
+
+/** Empty dl */
+void dlInit(DisplayList *dl);
+
+/** Record fillRectangle(col, row, width, height, colorBGR) */
+void dlFill(DisplayList *dl, u_char col, u_char row, u_char width, u_char height, 
+	    u_int colorBGR);
+
+/** Record drawChar5x7(col, row, c, fgColorBGR, bgColorBGR) */
+void dlChar5x7(DisplayList *dl, u_char col, u_char row, char c,
+	       u_int fgColorBGR, u_int bgColorBGR);
+
+/** Record drawString5x7(col, row, string, fgColorBGR, bgColorBGR), one command per char */
+void dlString5x7(DisplayList *dl, u_char col, u_char row, const char *string,
+		 u_int fgColorBGR, u_int bgColorBGR);
+
+/** Record a call to draw(arg), which must paint every pixel of the rectangle
+ *  (for example a layer redraw)
+ */
+void dlArea(DisplayList *dl, u_char col, u_char row, u_char width, u_char height,
+	    void (*draw)(const void *arg), const void *arg);
+
+/** Draw and empty dl
+ *
+ *  Commands completely painted over by later ones are dropped, same-colored
+ *  fills that touch are merged, and the rest are sorted top to bottom (where
+ *  that can't change the picture) so consecutive windows share row ranges.
+ *  A full display list flushes itself before recording more.
+ */
+void dlFlush(DisplayList *dl);
+
+#endif // included
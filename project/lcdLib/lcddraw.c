@@ -17,6 +17,47 @@ void drawPixel(u_char col, u_char row, u_int colorBGR)
   lcd_writeColor(colorBGR);
 }
 
+/** Sort points by row, then column, keeping equal points in their order */
+static void sortPoints(PlotPoint *points, u_int count)
+{
+  u_int i, j;
+  for (i = 1; i < count; i++) {
+    PlotPoint p = points[i];
+    for (j = i; j > 0; j--) {
+      PlotPoint *prev = &points[j-1];
+      if (prev->row < p.row || (prev->row == p.row && prev->col <= p.col))
+	break;
+      points[j] = *prev;
+    }
+    points[j] = p;
+  }
+}
+
+void plotPoints(PlotPoint *points, u_int count)
+{
+  PlotPoint *end = points + count;
+  sortPoints(points, count);
+  while (points < end) {
+    PlotPoint *run = points, *p;
+    u_char col = run->col;
+    /* extend the run while the next distinct point is the next column */
+    for (p = run + 1; p < end && p->row == run->row; p++) {
+      if (p->col == col)
+	continue;		/* same pixel again */
+      if (p->col != col + 1)
+	break;
+      col++;
+    }
+    lcd_setArea(run->col, run->row, col, run->row);
+    for (; run < p; run++) {
+      if (run + 1 < p && run[1].col == run->col)
+	continue;		/* a later point wins */
+      lcd_writeColor(run->colorBGR);
+    }
+    points = p;
+  }
+}
+
 /** Fill rectangle
  *
  *  \param colMin Column start
@@ -28,12 +69,14 @@ void drawPixel(u_char col, u_char row, u_int colorBGR)
 void fillRectangle(u_char colMin, u_char rowMin, u_char width, u_char height, 
 		   u_int colorBGR)
 {
-  u_char colLimit = colMin + width, rowLimit = rowMin + height;
-  lcd_setArea(colMin, rowMin, colLimit - 1, rowLimit - 1);
-  u_int total = width * height;
-  u_int c = 0;
-  while ((c++) < total) {
-    lcd_writeColor(colorBGR);
+  u_char colLimit = colMin + width, rowLimit = rowMin + height, row, last;
+  for (row = rowMin; row < rowLimit; row = last + 1) { /* windows split by scrolling */
+    last = lcd_setArea(colMin, row, colLimit - 1, rowLimit - 1);
+    u_int total = width * (last - row + 1);
+    u_int c = 0;
+    while ((c++) < total) {
+      lcd_writeColor(colorBGR);
+    }
   }
 }
 
@@ -58,9 +101,12 @@ void drawChar5x7(u_char rcol, u_char rrow, char c,
   u_char row = 0;
   u_char bit = 0x01;
   u_char oc = c - 0x20;
+  u_char last;
 
-  lcd_setArea(rcol, rrow, rcol + 4,rrow + 7); /* relative to requested col/row */
+  last = lcd_setArea(rcol, rrow, rcol + 4,rrow + 7); /* relative to requested col/row */
   while (row < 8) {
+    if (rrow + row > last)	/* window split by scrolling */
+      last = lcd_setArea(rcol, rrow + row, rcol + 4, rrow + 7);
     while (col < 5) {
       u_int colorBGR = (font_5x7[oc][col] & bit) ? fgColorBGR : bgColorBGR;
       lcd_writeColor(colorBGR);
@@ -115,3 +161,63 @@ void drawRectOutline(u_char colMin, u_char rowMin, u_char width, u_char height,
   fillRectangle(colMin + width, rowMin, 1, height, colorBGR);
 }
 
+
+/** Fill a line run (major axis from m0 to m1, thickness pixels across minor), clipped */
+static void lineRun(int m0, int m1, int minor, u_char steep, u_char thickness,
+		    u_int colorBGR)
+{
+  int lo = m0 < m1 ? m0 : m1, hi = m0 < m1 ? m1 : m0;
+  int minorLo = minor - (thickness - 1) / 2, minorHi = minor + thickness / 2;
+  int colMin, colMax, rowMin, rowMax;
+  if (steep) {
+    colMin = minorLo; colMax = minorHi; rowMin = lo; rowMax = hi;
+  } else {
+    colMin = lo; colMax = hi; rowMin = minorLo; rowMax = minorHi;
+  }
+  if (colMin < 0) colMin = 0;
+  if (rowMin < 0) rowMin = 0;
+  if (colMax >= screenWidth) colMax = screenWidth - 1;
+  if (rowMax >= screenHeight) rowMax = screenHeight - 1;
+  if (colMin <= colMax && rowMin <= rowMax)
+    fillRectangle(colMin, rowMin, colMax - colMin + 1, rowMax - rowMin + 1, colorBGR);
+}
+
+void drawThickLine(u_char col0, u_char row0, u_char col1, u_char row1,
+		   u_char thickness, u_int colorBGR)
+{
+  int dCol = col1 > col0 ? col1 - col0 : col0 - col1;
+  int dRow = row1 > row0 ? row1 - row0 : row0 - row1;
+  u_char steep = dRow > dCol;	/* walk rows, runs are vertical */
+  int major = steep ? row0 : col0, majorEnd = steep ? row1 : col1;
+  int minor = steep ? col0 : row0, minorEnd = steep ? col1 : row1;
+  int dMajor = steep ? dRow : dCol, dMinor = steep ? dCol : dRow;
+  int majorStep = majorEnd > major ? 1 : -1, minorStep = minorEnd > minor ? 1 : -1;
+  int err = dMajor / 2, runStart = major;
+
+  if (!thickness)
+    return;
+  for (;; major += majorStep) {
+    if (major == majorEnd) {
+      lineRun(runStart, major, minor, steep, thickness, colorBGR);
+      break;
+    }
+    err -= dMinor;
+    if (err < 0) {		/* next pixel steps across: end this run */
+      lineRun(runStart, major, minor, steep, thickness, colorBGR);
+      minor += minorStep;
+      err += dMajor;
+      runStart = major + majorStep;
+    }
+  }
+}
+
+void drawLine(u_char col0, u_char row0, u_char col1, u_char row1, u_int colorBGR)
+{
+  drawThickLine(col0, row0, col1, row1, 1, colorBGR);
+}
+
+void drawPolyline(const u_char vertices[], u_char numVertices, u_int colorBGR)
+{
+  for (; numVertices > 1; numVertices--, vertices += 2)
+    drawLine(vertices[0], vertices[1], vertices[2], vertices[3], colorBGR);
+}
@@ -47,11 +47,29 @@ u_char _orientation = 0;
 #define CASETP							0x2A
 #define PASETP							0x2B
 #define RAMWRP							0x2C
+#define VSCRDEF							0x33
 #define	MADCTL							0x36
+#define VSCRSADD						0x37
 #define	COLMOD							0x3A
 #define GMCTRP1							0xE0
 #define GMCTRN1							0xE1
 
+/** MADCTL bits: row address order, column address order, row/column exchange */
+#define MADCTL_MY						0x80
+#define MADCTL_MX						0x40
+#define MADCTL_MV						0x20
+
+/** MADCTL value for ORIENTATION */
+#if ORIENTATION == ORIENTATION_HORIZONTAL
+# define MADCTL_ORIENTATION 0x68
+#elif ORIENTATION == ORIENTATION_VERTICAL_ROTATED
+# define MADCTL_ORIENTATION 0x08
+#elif ORIENTATION == ORIENTATION_HORIZONTAL_ROTATED
+# define MADCTL_ORIENTATION 0xA8
+#else
+# define MADCTL_ORIENTATION 0xC8
+#endif
+
 /** Set up onboard LCD's SPI and control pins */
 static void setUpSPIforLCD() {
   LCD_DC_OUT |= LCD_DC_PIN;
@@ -115,26 +133,109 @@ void _delay(u_char x10ms) {
 	}
 }
 
-/** Set area to draw to */
-void lcd_setArea(u_char colStart, u_char rowStart, u_char colEnd, u_char rowEnd) 
+/** Window last sent to the LCD (colEnd < colStart: unknown) */
+static u_char areaColStart = 1, areaColEnd = 0, areaRowStart = 1, areaRowEnd = 0;
+
+void lcd_forgetArea()
+{
+	areaColStart = areaRowStart = 1;
+	areaColEnd = areaRowEnd = 0;
+}
+
+/** Scroll area: logical rows scrollTop..scrollTop+scrollRows-1 (0 rows: none).
+ *  Logical row scrollTop+i is stored in RAM row scrollTop+(i+scrollOffset)%scrollRows.
+ */
+static u_char scrollTop = 0, scrollRows = 0, scrollOffset = 0;
+
+/** Send row range if the LCD does not already have it, then start writing */
+static void areaSendRows(u_char rowStart, u_char rowEnd)
 {
-	_writeCommand(CASETP);
+	if (rowStart != areaRowStart || rowEnd != areaRowEnd) {
+		_writeCommand(PASETP);
+		lcd_writeData(0);
+		lcd_writeData(rowStart);
+		lcd_writeData(0);
+		lcd_writeData(rowEnd);
+		areaRowStart = rowStart; areaRowEnd = rowEnd;
+	}
+	_writeCommand(RAMWRP);
+}
+
+/** Set area to draw to (column or row ranges the LCD already has are not resent) */
+u_char lcd_setArea(u_char colStart, u_char rowStart, u_char colEnd, u_char rowEnd) 
+{
+	u_char ram = rowStart, last = rowEnd, scrollEnd = scrollTop + scrollRows;
+	if (colStart != areaColStart || colEnd != areaColEnd) {
+		_writeCommand(CASETP);
+		lcd_writeData(0);
+		lcd_writeData(colStart);
+		lcd_writeData(0);
+		lcd_writeData(colEnd);
+		areaColStart = colStart; areaColEnd = colEnd;
+	}
+	if (scrollOffset) {		/* translate to RAM rows, up to a discontinuity */
+		if (rowStart < scrollTop) {	/* top fixed area */
+			if (last >= scrollTop)
+				last = scrollTop - 1;
+		} else if (rowStart < scrollEnd) {
+			if (rowStart < scrollEnd - scrollOffset) { /* before wrap */
+				ram = rowStart + scrollOffset;
+				scrollEnd -= scrollOffset;
+			} else		/* after wrap */
+				ram = rowStart + scrollOffset - scrollRows;
+			if (last >= scrollEnd)
+				last = scrollEnd - 1;
+		}
+	}
+	areaSendRows(ram, ram + (last - rowStart));
+	return last;
+}
+
+/** Tell the LCD where the scroll area's first row starts in RAM */
+static void scrollSendStart()
+{
+	_writeCommand(VSCRSADD);
 	lcd_writeData(0);
-	lcd_writeData(colStart);
+	lcd_writeData(scrollTop + scrollOffset);
+}
+
+void lcd_setScrollArea(u_char topFixed, u_char bottomFixed)
+{
+#if ORIENTATION == ORIENTATION_VERTICAL_ROTATED
+	if (topFixed + bottomFixed >= screenHeight)
+		return;
+	scrollTop = topFixed;
+	scrollRows = screenHeight - topFixed - bottomFixed;
+	scrollOffset = 0;
+	_writeCommand(VSCRDEF);
 	lcd_writeData(0);
-	lcd_writeData(colEnd);
-	_writeCommand(PASETP);
+	lcd_writeData(topFixed);
 	lcd_writeData(0);
-	lcd_writeData(rowStart);
+	lcd_writeData(scrollRows);
 	lcd_writeData(0);
-	lcd_writeData(rowEnd);
-	_writeCommand(RAMWRP);
+	lcd_writeData(bottomFixed);
+	scrollSendStart();
+#endif
+}
+
+void lcd_scroll(int rows)
+{
+	int offset;
+	if (!scrollRows)
+		return;
+	offset = (scrollOffset + rows) % scrollRows;
+	if (offset < 0)
+		offset += scrollRows;
+	scrollOffset = offset;
+	scrollSendStart();
 }
 
 /** Initialize onboard LCD */
 void lcd_init() 
 {
   setUpSPIforLCD();
+  lcd_forgetArea();
+  scrollTop = scrollRows = scrollOffset = 0; /**< reset also ends scrolling */
   _writeCommand(SWRESET);  /**< software reset */
   _delay(20);
   _writeCommand(SLEEPOUT); /**< exit sleep */
@@ -144,18 +245,268 @@ void lcd_init()
   _writeCommand(DISPON);   /**< display ON */
 
   _writeCommand(MADCTL);
-  switch (ORIENTATION) {
-  case ORIENTATION_HORIZONTAL:
-    lcd_writeData(0x68);
-    break;
-  case ORIENTATION_VERTICAL_ROTATED:
-    lcd_writeData(0x08);
-    break;
-  case ORIENTATION_HORIZONTAL_ROTATED:
-    lcd_writeData(0xA8);
-    break;
-  default:
-    lcd_writeData(0xC8);
+  lcd_writeData(MADCTL_ORIENTATION);
+}
+
+/** Window for a flipped stream, in address space of MADCTL_ORIENTATION ^ flip bits */
+int lcd_setAreaFlipped(u_char col, u_char row, u_char width, u_char height, u_char flip)
+{
+#if ORIENTATION == ORIENTATION_VERTICAL_ROTATED
+	u_char bits = 0, cols = width, rows = height, colStart, rowStart;
+	if (scrollOffset)		/* rows would need translating */
+		return 0;
+	if (flip & LCD_FLIP_TRANSPOSE) { /* sprite rows run down the screen */
+		bits = MADCTL_MV;
+		cols = height; rows = width;
+	}
+	if (flip & LCD_FLIP_H)
+		bits |= (flip & LCD_FLIP_TRANSPOSE) ? MADCTL_MY : MADCTL_MX;
+	if (flip & LCD_FLIP_V)
+		bits |= (flip & LCD_FLIP_TRANSPOSE) ? MADCTL_MX : MADCTL_MY;
+	colStart = (bits & MADCTL_MX) ? screenWidth - col - cols : col;
+	rowStart = (bits & MADCTL_MY) ? screenHeight - row - rows : row;
+	_writeCommand(MADCTL);
+	lcd_writeData(MADCTL_ORIENTATION | bits);
+	lcd_forgetArea();		/* windows now address the panel differently */
+	if (bits & MADCTL_MV)
+		lcd_setArea(rowStart, colStart, rowStart + rows - 1, colStart + cols - 1);
+	else
+		lcd_setArea(colStart, rowStart, colStart + cols - 1, rowStart + rows - 1);
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+void lcd_endFlipped()
+{
+	_writeCommand(MADCTL);
+	lcd_writeData(MADCTL_ORIENTATION);
+	lcd_forgetArea();
+}
+
+/** Draw pixel (x, y) of a width x height image, flipped, with a window of its own */
+static void flippedPixel(u_char col, u_char row, u_char width, u_char height, 
+			 u_char flip, u_char x, u_char y, u_int colorBGR)
+{
+	u_char t;
+	if (flip & LCD_FLIP_H) x = width - 1 - x;
+	if (flip & LCD_FLIP_V) y = height - 1 - y;
+	if (flip & LCD_FLIP_TRANSPOSE) { t = x; x = y; y = t; }
+	lcd_setArea(col + x, row + y, col + x, row + y);
+	lcd_writeColor(colorBGR);
+}
+
+
+/** Bytes per row of a packed sprite plane with bpp bits per pixel */
+#define spriteStride(sprite, bpp) ((((sprite)->width) * (bpp) + 7) >> 3)
+
+int 
+spritePixel(const Sprite *s, u_char col, u_char row, u_int *colorBGR)
+{
+  u_char index = 0;
+  if (s->mask && !(s->mask[row * spriteStride(s, 1) + (col >> 3)] & (0x80 >> (col & 7))))
+    return 0;
+  if (s->pixels) {
+    u_int bit = col * s->bpp;	/* bit offset of pixel within row */
+    u_char byte = s->pixels[row * spriteStride(s, s->bpp) + (bit >> 3)];
+    index = (byte >> (8 - s->bpp - (bit & 7))) & ((1 << s->bpp) - 1);
+  }
+  *colorBGR = s->palette[index];
+  return 1;
+}
+
+u_char 
+spriteNextRun(const Sprite *s, u_char row, u_char *col)
+{
+  const u_char *mask;
+  u_char c = *col, start, width = s->width;
+  if (c >= width)
+    return 0;
+  if (!s->mask)			/* fully opaque */
+    return width - c;
+  mask = s->mask + row * spriteStride(s, 1);
+  while (c < width && !(mask[c >> 3] & (0x80 >> (c & 7)))) {
+    if (!(c & 7) && !mask[c >> 3])
+      c += 8;			/* skip fully transparent byte */
+    else
+      c++;
+  }
+  if (c >= width)
+    return 0;
+  start = c;
+  while (c < width && (mask[c >> 3] & (0x80 >> (c & 7)))) {
+    if (!(c & 7) && mask[c >> 3] == 0xff)
+      c += 8;			/* skip fully opaque byte */
+    else
+      c++;
+  }
+  if (c > width)
+    c = width;
+  *col = start;
+  return c - start;
+}
+
+/** Stream cols [col, col+count) of sprite's row, expanding palette indices */
+static void 
+spriteStreamRow(const Sprite *s, u_char row, u_char col, u_char count, u_int bgColorBGR)
+{
+  u_char bpp = s->bpp, indexMask = (1 << bpp) - 1;
+  const u_int *palette = s->palette;
+  const u_char *pixels = s->pixels ? s->pixels + row * spriteStride(s, bpp) : 0;
+  const u_char *mask = s->mask ? s->mask + row * spriteStride(s, 1) : 0;
+  u_int bit = col * bpp;
+  u_char pixelByte = pixels ? pixels[bit >> 3] << (bit & 7) : 0;
+  u_char maskByte = mask ? mask[col >> 3] << (col & 7) : 0xff;
+  while (count--) {
+    u_char index = pixelByte >> (8 - bpp);
+    if (maskByte & 0x80)
+      lcd_writeColor(palette[pixels ? index & indexMask : 0]);
+    else
+      lcd_writeColor(bgColorBGR);
+    col++;
+    bit += bpp;
+    if (!(bit & 7)) {		/* next byte of indices */
+      if (pixels) pixelByte = pixels[bit >> 3];
+    } else
+      pixelByte <<= bpp;
+    if (mask) {
+      if (!(col & 7))		/* next byte of mask */
+	maskByte = mask[col >> 3];
+      else
+	maskByte <<= 1;
+    }
+  }
+}
+
+void 
+lcd_blit(u_char col, u_char row, const Sprite *s, u_int bgColorBGR)
+{
+  u_char r, last = lcd_setArea(col, row, col + s->width - 1, row + s->height - 1);
+  for (r = 0; r < s->height; r++) {
+    if (row + r > last)		/* window split by scrolling */
+      last = lcd_setArea(col, row + r, col + s->width - 1, row + s->height - 1);
+    spriteStreamRow(s, r, 0, s->width, bgColorBGR);
+  }
+}
+
+void 
+lcd_blitFlipped(u_char col, u_char row, const Sprite *s, u_int bgColorBGR, u_char flip)
+{
+  u_char r, c;
+  u_int colorBGR;
+  if (lcd_setAreaFlipped(col, row, s->width, s->height, flip)) {
+    for (r = 0; r < s->height; r++)
+      spriteStreamRow(s, r, 0, s->width, bgColorBGR);
+    lcd_endFlipped();
+    return;
   }
+  for (r = 0; r < s->height; r++)
+    for (c = 0; c < s->width; c++) {
+      if (!spritePixel(s, c, r, &colorBGR))
+	colorBGR = bgColorBGR;
+      flippedPixel(col, row, s->width, s->height, flip, c, r, colorBGR);
+    }
 }
 
+void 
+lcd_blitTransparent(u_char col, u_char row, const Sprite *s)
+{
+  u_char r, c, len;
+  for (r = 0; r < s->height; r++) {
+    for (c = 0; (len = spriteNextRun(s, r, &c)); c += len) {
+      lcd_setArea(col + c, row + r, col + c + len - 1, row + r);
+      spriteStreamRow(s, r, c, len, 0);
+    }
+  }
+}
+
+/** Decode next run code: returns palette index, stores run length */
+static u_char 
+rleNextRun(const u_char **runs, u_int *length)
+{
+  u_char code = *(*runs)++;
+  u_char lengthBits = code & 0x0f;
+  *length = (lengthBits < 15) ? lengthBits + 1 : 16 + *(*runs)++;
+  return code >> 4;
+}
+
+void 
+lcd_blitRle(u_char col, u_char row, const RleSprite *rle, u_int bgColorBGR)
+{
+  const u_char *runs = rle->runs;
+  u_int remaining = rle->width * rle->height, length, opened;
+  u_char colEnd = col + rle->width - 1, rowEnd = row + rle->height - 1;
+  u_char last = lcd_setArea(col, row, colEnd, rowEnd);
+  opened = rle->width * (last - row + 1); /* pixels before the window splits */
+  while (remaining) {
+    u_char index = rleNextRun(&runs, &length);
+    u_int colorBGR = (index == RLE_TRANSPARENT) ? bgColorBGR : rle->palette[index];
+    remaining -= length;
+    while (length > opened) {	/* run crosses a split made by scrolling */
+      length -= opened;
+      while (opened--)
+	lcd_writeColor(colorBGR);
+      row = last + 1;
+      last = lcd_setArea(col, row, colEnd, rowEnd);
+      opened = rle->width * (last - row + 1);
+    }
+    opened -= length;
+    while (length--)
+      lcd_writeColor(colorBGR);
+  }
+}
+
+void 
+lcd_blitRleFlipped(u_char col, u_char row, const RleSprite *rle, u_int bgColorBGR, u_char flip)
+{
+  const u_char *runs = rle->runs;
+  u_int remaining = rle->width * rle->height, length;
+  u_char streamed = lcd_setAreaFlipped(col, row, rle->width, rle->height, flip);
+  u_char c = 0, r = 0;
+  while (remaining) {
+    u_char index = rleNextRun(&runs, &length);
+    u_int colorBGR = (index == RLE_TRANSPARENT) ? bgColorBGR : rle->palette[index];
+    remaining -= length;
+    while (length--) {
+      if (streamed)
+	lcd_writeColor(colorBGR);
+      else
+	flippedPixel(col, row, rle->width, rle->height, flip, c, r, colorBGR);
+      if (++c == rle->width) {
+	c = 0;
+	r++;
+      }
+    }
+  }
+  if (streamed)
+    lcd_endFlipped();
+}
+
+void 
+lcd_blitRleTransparent(u_char col, u_char row, const RleSprite *rle)
+{
+  const u_char *runs = rle->runs;
+  u_char c = 0, r = 0;
+  u_int length;
+  while (r < rle->height) {
+    u_char index = rleNextRun(&runs, &length);
+    while (length) {		/* split run at row ends */
+      u_char count = rle->width - c;
+      if (length < count)
+	count = length;
+      if (index != RLE_TRANSPARENT) {
+	u_int colorBGR = rle->palette[index], n = count;
+	lcd_setArea(col + c, row + r, col + c + count - 1, row + r);
+	while (n--)
+	  lcd_writeColor(colorBGR);
+      }
+      length -= count;
+      c += count;
+      if (c == rle->width) {
+	c = 0;
+	r++;
+      }
+    }
+  }
+}
@@ -43,12 +43,43 @@ void lcd_init();
 
 /** Set area to draw to
  *  
+ *  While lcd_scroll() has moved the scroll area, a window's rows may not
+ *  be contiguous in the LCD's RAM: then only rows up to the first break
+ *  are opened, and the caller sets the area again for the rest.
+ *
  *  \param colStart Start column of the area
  *  \param rowStart Start row of the area
  *  \param colEnd End column of the area
  *  \param rowEnd End row of the area
+ *  \return Last row opened (rowEnd unless the window was split)
+ */
+u_char lcd_setArea(u_char colStart, u_char rowStart, u_char colEnd, u_char rowEnd);
+
+/** Make the next lcd_setArea send its whole window.
+ *  lcd_setArea skips column and row ranges the LCD already has;
+ *  call this after commanding the LCD directly in a way that resets them.
+ */
+void lcd_forgetArea();
+
+/** Hardware vertical scrolling
+ *
+ *  Rows topFixed..screenHeight-bottomFixed-1 become a scroll area whose
+ *  contents lcd_scroll() moves without redrawing; the rows above and below
+ *  it stay put.  Draw calls keep using screen rows: lcd_setArea translates
+ *  them to the LCD's RAM rows (splitting windows at the wrap), so after
+ *  lcd_scroll(n) only the n rows at the bottom of the scroll area need
+ *  to be drawn.  Only available in the default orientation
+ *  (ORIENTATION_VERTICAL_ROTATED); elsewhere this does nothing.
+ *
+ *  \param topFixed Rows fixed at the top of the screen
+ *  \param bottomFixed Rows fixed at the bottom of the screen
+ */
+void lcd_setScrollArea(u_char topFixed, u_char bottomFixed);
+
+/** Scroll the scroll area's contents up by rows (down if negative).
+ *  Rows leaving the top reappear at the bottom until redrawn.
  */
-void lcd_setArea(u_char colStart, u_char rowStart, u_char colEnd, u_char rowEnd);
+void lcd_scroll(int rows);
 
 /** Write color to LCD
  *
@@ -56,6 +87,112 @@ void lcd_setArea(u_char colStart, u_char rowStart, u_char colEnd, u_char rowEnd)
  */
 void lcd_writeColor(u_int colorBGR);
 
+/** Packed bitmap image stored in flash
+ *
+ *  pixels: bpp (1, 2 or 4) bit palette indices, leftmost pixel in the most 
+ *  significant bits, each row padded to a whole byte.  May be 0, in which 
+ *  case every opaque pixel is palette[0].
+ *
+ *  mask: 1 bit per pixel (1 = opaque), leftmost pixel in the msb, each row
+ *  padded to a whole byte.  May be 0 if every pixel is opaque.
+ *
+ *  palette: 1<<bpp BGR colors.
+ */
+typedef struct {
+  u_char width, height, bpp;
+  const u_char *pixels, *mask;
+  const u_int *palette;
+} Sprite;
+
+/** True if sprite's pixel at (col, row) is opaque; its color is stored in *colorBGR
+ */
+int spritePixel(const Sprite *sprite, u_char col, u_char row, u_int *colorBGR);
+
+/** Find the next run of opaque pixels in a sprite's row
+ *
+ *  \param sprite The sprite
+ *  \param row Row within the sprite
+ *  \param col (in and out) First col to consider; on return, the run's first col
+ *  \return Length of the run, or 0 if no opaque pixels remain in the row
+ */
+u_char spriteNextRun(const Sprite *sprite, u_char row, u_char *col);
+
+/** Draw sprite with its top-left pixel at (col, row) using a single window
+ *
+ *  Palette indices are expanded while streaming to the LCD.
+ *  Transparent pixels are drawn in bgColorBGR.  Sprite must be on screen.
+ */
+void lcd_blit(u_char col, u_char row, const Sprite *sprite, u_int bgColorBGR);
+
+/** Flip bits for mirrored and rotated drawing.
+ *
+ *  LCD_FLIP_H and LCD_FLIP_V reverse an image's columns and rows;
+ *  LCD_FLIP_TRANSPOSE then swaps its axes (its rows run down the screen).
+ */
+#define LCD_FLIP_H		1
+#define LCD_FLIP_V		2
+#define LCD_FLIP_TRANSPOSE	4
+#define LCD_ROTATE_CW		(LCD_FLIP_TRANSPOSE | LCD_FLIP_V)
+#define LCD_ROTATE_CCW		(LCD_FLIP_TRANSPOSE | LCD_FLIP_H)
+#define LCD_ROTATE_180		(LCD_FLIP_H | LCD_FLIP_V)
+
+/** Set area for a width x height image streamed row by row in its own
+ *  order, to be drawn flipped with its top-left pixel at (col, row).
+ *
+ *  Sets the LCD's MADCTL direction bits so the flip costs nothing per
+ *  pixel.  Call lcd_endFlipped() once width*height colors are written.
+ *  Returns 0 (and changes nothing) where this is unavailable: outside the
+ *  default orientation or while lcd_scroll() has moved the scroll area.
+ *
+ *  \param flip LCD_FLIP_* bits (the image covers height cols and width
+ *  rows if LCD_FLIP_TRANSPOSE is set)
+ */
+int lcd_setAreaFlipped(u_char col, u_char row, u_char width, u_char height, u_char flip);
+
+/** Restore the LCD's orientation after lcd_setAreaFlipped() */
+void lcd_endFlipped();
+
+/** lcd_blit, with the sprite flipped (LCD_FLIP_* bits) 
+ *
+ *  Costs the same as lcd_blit unless lcd_setAreaFlipped() is unavailable,
+ *  in which case each pixel gets its own window.
+ */
+void lcd_blitFlipped(u_char col, u_char row, const Sprite *sprite, u_int bgColorBGR, u_char flip);
+
+/** Draw only the opaque pixels of sprite, one window per opaque run
+ */
+void lcd_blitTransparent(u_char col, u_char row, const Sprite *sprite);
+
+/** Palette index of transparent pixels in an RleSprite */
+#define RLE_TRANSPARENT 15
+
+/** Run-length encoded image (generated from image files by spriteLib's makeSprites)
+ *
+ *  runs: run codes covering width*height pixels in row-major order (runs may
+ *  continue onto the next row).  The high nibble of each code is a palette 
+ *  index (RLE_TRANSPARENT for transparent pixels).  The low nibble L gives 
+ *  the run length: L+1 if L < 15, otherwise 16 + the following byte.
+ */
+typedef struct {
+  u_char width, height;
+  const u_int *palette;
+  const u_char *runs;
+} RleSprite;
+
+/** Decode rle sprite straight to the LCD through a single window 
+ *  with its top-left pixel at (col, row).
+ *  Transparent runs are drawn in bgColorBGR.  Sprite must be on screen.
+ */
+void lcd_blitRle(u_char col, u_char row, const RleSprite *rle, u_int bgColorBGR);
+
+/** lcd_blitRle, with the sprite flipped (LCD_FLIP_* bits, see lcd_blitFlipped)
+ */
+void lcd_blitRleFlipped(u_char col, u_char row, const RleSprite *rle, u_int bgColorBGR, u_char flip);
+
+/** Decode rle sprite, skipping transparent runs (one window per opaque run and row)
+ */
+void lcd_blitRleTransparent(u_char col, u_char row, const RleSprite *rle);
+
 #define rgb2bgr(val) ((((val) << 11)&0xf800) | ((val)&0x7e0) | (((val)>>11)&0x1f))
 
 /** Colors */
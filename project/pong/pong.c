@@ -2,6 +2,7 @@
 #include <libTimer.h>
 #include <lcdutils.h>
 #include <lcddraw.h>
+#include <displaylist.h>
 #include <p2switches.h>
 #include <shape.h>
 #include <abCircle.h>
@@ -11,6 +12,8 @@
 
 static char sl = '0';
 static char sr = '0';
+static char slShown = 0;        /**< score digits on screen (0: none yet) */
+static char srShown = 0;
 static int s1 = 0;
 static int s2 = 0;
 
@@ -47,7 +50,8 @@ Layer fieldLayer = {		/* playing field as a layer */
     {screenWidth/2-1, screenHeight/2},          /**< center */
     {0,0}, {0,0},				    /* last & next pos */
     COLOR_BLACK,
-    &pr
+    &pr,
+    LAYER_STATIC
 };
 
 Layer layer0 = { //Ball
@@ -58,146 +62,127 @@ Layer layer0 = { //Ball
     &fieldLayer,
 };
 
-/** Moving Layer
- *  Linked list of layer references
- *  Velocity represents one iteration of change (direction & magnitude)
- */
-
-
 /*LEFT PADDLE UP*/
-MovLayer pLU = {&pl, {0,-4}, 0};
+MovLayer pLU = {&pl, {0,Q8(-4)}, 0};
 /*LEFT PADDLE DOWN*/
-MovLayer pLD = {&pl, {0,4}, 0};
+MovLayer pLD = {&pl, {0,Q8(4)}, 0};
 /*RIGHT PADDLE UP*/
-MovLayer pRU = {&pr, {0,4}, 0};
+MovLayer pRU = {&pr, {0,Q8(4)}, 0};
 /*RIGHT PADDLE DOWN*/
-MovLayer pRD = {&pr, {0,-4}, 0};
+MovLayer pRD = {&pr, {0,Q8(-4)}, 0};
 /*BALL*/
-MovLayer ml0 = {&layer0, {1,1}, 0};
+MovLayer ml0 = {&layer0, {Q8(1),Q8(1)}, 0};
 
 /*REGION DEFINITIONS*/
 Region fieldFence;		/**< fence around playing field  */
-Region pLFence;
-Region pRFence;
+StaticLayerCache staticCache;   /**< the field, pre-rasterized */
 
+#define BEEP_CYCLES 200000      /**< length of a paddle or wall beep (MCLK cycles) */
+/** Time left to draw a frame (timerA1Read ticks, SMCLK/8 = 250 kHz):
+ *  5 watchdog intervals of 8192 SMCLK cycles, less the beep (MCLK/64) */
+#define FRAME_BUDGET (5 * 8192 / 8 - BEEP_CYCLES / 64)
+Governor governor;              /**< merges redraws and drops HUD refreshes when frames run late */
 
-void movLayerDraw(MovLayer *movLayers, Layer *layers) {
-    int row, col;
-    MovLayer *movLayer;
-    
-    and_sr(~8);			/**< disable interrupts (GIE off) */
-    for (movLayer = movLayers; movLayer; movLayer = movLayer->next) { /* for each moving layer */
-        Layer *l = movLayer->layer;
-        l->posLast = l->pos;
-        l->pos = l->posNext;
-    }
-    or_sr(8);			/**< disable interrupts (GIE on) */
-    
-    
-    for (movLayer = movLayers; movLayer; movLayer = movLayer->next) { /* for each moving layer */
+#define SCORE_ROW 10            /**< top row of the score digits */
+#define MAX_DIRTY 4             /**< separate areas a frame redraws */
+DisplayList frameList;          /**< the frame's redraws, sent by dlFlush */
+Region dirty[MAX_DIRTY];        /**< areas moving layers left or entered this frame */
+u_char numDirty = 0;
+u_char hudDamaged = 0;          /**< a redraw reached the score's rows */
+
+/** dlArea callback: redraws the layers in a dirty area */
+static void drawDirty(const void *area) {
+    layerDrawRegion(&layer0, (const Region *)area);
+}
+
+/** Like movLayerDrawMerged, but only adds the areas to redraw to dirty
+ *  (merged within the governor's slack); recordDirty records them. */
+static void movLayerRecord(MovLayer *movLayers) {
+    MovLayer *ml;
+    u_int slack = governorMergeSlack(&governor);
+    movLayerCommit(movLayers);
+    for (ml = movLayers; ml; ml = ml->next) {
         Region bounds;
-        layerGetBounds(movLayer->layer, &bounds);
-        lcd_setArea(bounds.topLeft.axes[0], bounds.topLeft.axes[1], 
-                    bounds.botRight.axes[0], bounds.botRight.axes[1]);
-        for (row = bounds.topLeft.axes[1]; row <= bounds.botRight.axes[1]; row++) {
-            for (col = bounds.topLeft.axes[0]; col <= bounds.botRight.axes[0]; col++) {
-                Vec2 pixelPos = {col, row};
-                u_int color = bgColor;
-                Layer *probeLayer;
-                for (probeLayer = layers; probeLayer; 
-                     probeLayer = probeLayer->next) { /* probe all layers, in order */
-                         if (abShapeCheck(probeLayer->abShape, &probeLayer->pos, &pixelPos)) {
-                             color = probeLayer->color;
-                             break; 
-                         } /* if probe check */
-                     } // for checking all layers at col, row
-                     lcd_writeColor(color); 
-            } // for col
-        } // for row
-    } // for moving layer being updated
-}	  
+        u_char i;
+        if (!(ml->layer->flags & LAYER_MOVED))
+            continue;           /**< nothing to redraw */
+        layerGetBounds(ml->layer, &bounds);
+        for (i = 0; i < numDirty; i++)
+            if (regionMerge(&dirty[i], &bounds, slack))
+                break;
+        if (i < numDirty)
+            continue;           /**< merged */
+        if (numDirty < MAX_DIRTY)
+            dirty[numDirty++] = bounds;
+        else                    /**< no room left */
+            regionUnion(&dirty[numDirty - 1], &dirty[numDirty - 1], &bounds);
+    }
+}
 
-/** Advances a moving shape within a fence
- *  
- *  \param ml The moving shape to be advanced
- *  \param fence The region which will serve as a boundary for ml
- */
-void mlAdvance(MovLayer *ml, Region *fence) {
-    Vec2 newPos;
-    Vec2 paddleL;
-    Vec2 paddleR;
-    u_char axis;
-    int velocity;
-    Region shapeBoundary;
-    for (; ml; ml = ml->next) {
-        vec2Add(&newPos, &ml->layer->posNext, &ml->velocity); // fence
-        abShapeGetBounds(ml->layer->abShape, &newPos, &shapeBoundary);
-        for (axis = 0; axis < 2; axis ++) {
-            if (shapeBoundary.topLeft.axes[axis] < fence->topLeft.axes[axis]) {
-                newPos.axes[axis] -= -4;
-            }
-            if (shapeBoundary.botRight.axes[axis] > fence->botRight.axes[axis]) {
-                newPos.axes[axis] += -3;
-            }
-        } /**< for axis */
-        ml->layer->posNext = newPos;
-    } /**< for ml */
+/** Records the frame's dirty areas in frameList */
+static void recordDirty() {
+    u_char i;
+    for (i = 0; i < numDirty; i++) {
+        Region *area = &dirty[i];
+        if (area->topLeft.axes[1] < SCORE_ROW + 8)
+            hudDamaged = 1;
+        dlArea(&frameList, area->topLeft.axes[0], area->topLeft.axes[1],
+               area->botRight.axes[0] - area->topLeft.axes[0] + 1,
+               area->botRight.axes[1] - area->topLeft.axes[1] + 1,
+               drawDirty, area);
+    }
 }
 
+
+/** Advances the ball, bouncing off the field's fence and the paddles
+ *  
+ *  The ball's whole step is swept, so even a fast ball can't skip
+ *  over a paddle; it stops where it first touches something.
+ *
+ *  \param ml The ball
+ *  \param pLU Any MovLayer of the left paddle
+ *  \param pRU Any MovLayer of the right paddle
+ *  \param fence The playing field
+ */
 void paddleAdvance(MovLayer *ml, MovLayer *pLU, MovLayer *pRU, Region *fence) {
-    Vec2 newPos;
-    Vec2 paddleL;
-    Vec2 paddleR;
-    u_char axis;
-    Region shapeBoundary;
+    Vec2 newPos, step;
+    Impact impact, paddleImpact;
     for (; ml; ml = ml->next) {
-        vec2Add(&newPos, &ml->layer->posNext, &ml->velocity); // BALL
-        abShapeGetBounds(ml->layer->abShape, &newPos, &shapeBoundary);
-        
-        vec2Add(&paddleL, &pLU->layer->posNext, &pLU->velocity); //Paddle left
-        abShapeGetBounds(pLU->layer->abShape, &paddleL, &pLFence);
+        AbShape *ball = ml->layer->abShape;
+        Vec2 *from = &ml->layer->posNext;
+        int hitFence, hitPaddle = 0;
+        mlStep(ml, &step);
+        hitFence = abShapeSweepRegion(ball, from, &step, fence, &impact);
         
-        vec2Add(&paddleR, &pRU->layer->posNext, &pRU->velocity); //Paddle right
-        abShapeGetBounds(pRU->layer->abShape, &paddleR, &pRFence);
+        if (abShapeSweep(ball, from, &step, pLU->layer->abShape, &pLU->layer->posNext, &paddleImpact) &&
+            (!hitFence || paddleImpact.time < impact.time)) {
+            impact = paddleImpact;
+            hitPaddle = 1;
+        }
+        if (abShapeSweep(ball, from, &step, pRU->layer->abShape, &pRU->layer->posNext, &paddleImpact) &&
+            (!(hitFence || hitPaddle) || paddleImpact.time < impact.time)) {
+            impact = paddleImpact;
+            hitPaddle = 1;
+        }
         
-        for (axis = 0; axis < 2; axis ++) {
-            if ((shapeBoundary.topLeft.axes[axis] < fence->topLeft.axes[axis]) ||
-                (shapeBoundary.botRight.axes[axis] > fence->botRight.axes[axis])) {
-                if (shapeBoundary.topLeft.axes[0] < fence->topLeft.axes[0]) {
-                    s2++;
-                    buzzer_set_period(1000);
-                }
-                if (shapeBoundary.botRight.axes[0] > fence->botRight.axes[0]) {
-                    s1++;
-                    buzzer_set_period(1000);
-                }
-                int velocity = ml->velocity.axes[axis] = -ml->velocity.axes[axis];
-            newPos.axes[axis] += (2*velocity);
-            break;
-            
-            
-            
-                }	/**< if outside of fence */
-                /*PADDLE LEFT COLISION*/
-                if ((shapeBoundary.topLeft.axes[0] <  pLFence.botRight.axes[0]) &&
-                    (shapeBoundary.botRight.axes[1]-10 < pLFence.botRight.axes[1]) &&
-                    (shapeBoundary.topLeft.axes[1]+10 > pLFence.topLeft.axes[1])) {
-                    int velocity = ml->velocity.axes[axis] = -ml->velocity.axes[axis];
-                newPos.axes[axis] += (2*velocity);
-                buzzer_set_period(4000);
-                break;
-                
-                    }
-                    /*PADDLE RIGHT COLISION*/
-                    if ((shapeBoundary.botRight.axes[0] >  pRFence.topLeft.axes[0]) &&
-                        (shapeBoundary.botRight.axes[1]-10 < pRFence.botRight.axes[1]) &&
-                        (shapeBoundary.topLeft.axes[1]+10 > pRFence.topLeft.axes[1])) {
-                        int velocity = ml->velocity.axes[axis] = -ml->velocity.axes[axis];
-                    newPos.axes[axis] += (2*velocity);
-                    buzzer_set_period(4000);
-                    break;
-                        }
-        } /*< for axis */
+        if (hitPaddle) {
+            newPos = impact.pos; /*PADDLE COLISION*/
+            mlReflect(ml, impact.side);
+            buzzer_set_period(4000);
+        } else if (hitFence) {
+            if (impact.side == COLLIDE_LEFT) {
+                s2++;
+                buzzer_set_period(1000);
+            }
+            if (impact.side == COLLIDE_RIGHT) {
+                s1++;
+                buzzer_set_period(1000);
+            }
+            newPos = impact.pos;
+            mlReflect(ml, impact.side);
+        } else {
+            vec2Add(&newPos, from, &step); // BALL
+        }
         ml->layer->posNext = newPos;
     } /**< for ml */
 }
@@ -208,7 +193,6 @@ int redrawScreen = 1;           /**< Boolean for whether screen needs to be redr
 
 
 
-
 /** Initializes everything, enables interrupts and green LED, 
  *  and handles the rendering for the screen */
 void main() {
@@ -226,11 +210,15 @@ void main() {
     
     
     layerInit(&layer0);
+    layerStaticInit(&staticCache, &layer0);
     layerDraw(&layer0);
     
     
     layerGetBounds(&fieldLayer, &fieldFence);
     
+    timerA1Continuous();        /**< frame clock for the governor */
+    governorInit(&governor, FRAME_BUDGET);
+    dlInit(&frameList);
     enableWDTInterrupts();      /**< enable periodic interrupt */
     or_sr(0x8);	              /**< GIE (enable interrupts) */
     
@@ -241,11 +229,17 @@ void main() {
         }
         P1OUT |= GREEN_LED;       /**< Green led on when CPU on */
         redrawScreen = 0;
-        movLayerDraw(&ml0, &layer0);
+        governorFrameBegin(&governor);
+        movLayerRecord(&ml0);
 	move(); //Assembly Function
 	//moveC(); //C funtion
-        score();
-        __delay_cycles(200000);
+        recordDirty();
+        if (governorHudDue(&governor))
+            score();
+        dlFlush(&frameList);    /**< the frame's redraws, culled and sorted */
+        numDirty = 0;
+        governorFrameEnd(&governor);
+        __delay_cycles(BEEP_CYCLES);
         buzzer_set_period(0);
     }
 }
@@ -255,47 +249,30 @@ void startup() {
     clearScreen(COLOR_BLACK);
     drawString5x7(screenWidth/2 -11,screenHeight/2 -40, "PONG", COLOR_WHITE, COLOR_BLACK);
     drawString5x7(6,screenHeight/2 +40, "E:S1 M:S2 H:S3 X:S4", COLOR_WHITE, COLOR_BLACK);
-    int dir1, dir2;
-    dir1 = -1;
-    dir2 = 1;
-//     int random = rand();
-//     if (random % 2 == 0) {
-//         dir1 = 1;
-//     }
-//     else {
-//         dir1 = 1;
-//     }
-//     random = rand();
-//     if (random % 2 == 0) {
-//         dir2 = 1;
-//     }
-//     else {
-//         dir2 = 1;
-//     }
+    u_char angle = 96;          /**< down and to the left */
     while (1) {
         if (!(P2IN & BIT0)) {
-            ml0.velocity.axes[0] = 1*dir1;
-            ml0.velocity.axes[1] = 1*dir2;
+            mlLaunch(&ml0, angle, 362); /**< 1.4 px/step: the old {1,1} */
             goto out;
         }
         if (!(P2IN & BIT1)) {
-            ml0.velocity.axes[0] = 2*dir1;
-            ml0.velocity.axes[1] = 2*dir2;
+            mlLaunch(&ml0, angle, 543); /**< 2.1 px/step */
             goto out;
         }
         if (!(P2IN & BIT2)) {
-            ml0.velocity.axes[0] = 3*dir1;
-            ml0.velocity.axes[1] = 3*dir2;
+            mlLaunch(&ml0, angle, 724); /**< 2.8 px/step */
             goto out;
         }
         if (!(P2IN & BIT3)) {
-            ml0.velocity.axes[0] = 4*dir1;
-            ml0.velocity.axes[1] = 4*dir2;
+            mlLaunch(&ml0, angle, 905); /**< 3.5 px/step */
             goto out;
         }
         if ((!(P2IN & BIT0)) && (!(P2IN & BIT3))) {
             WDTCTL = 0;  
         }   
+        angle++;                /**< waiting for a button picks a launch angle */
+        if (angle > 112)
+            angle = 80;
     }
     out: ;
     clearScreen(COLOR_BLACK);
@@ -378,45 +355,51 @@ void score() {
             WDTCTL = 0; 
             break;
     }
-    drawChar5x7(screenWidth/2 -30, 10, sl, COLOR_WHITE, COLOR_BLACK);
-    drawChar5x7(screenWidth/2 +30, 10, sr, COLOR_WHITE, COLOR_BLACK);
+    /* only redraw digits that changed or that a layer redraw may have erased */
+    if (sl != slShown || hudDamaged)
+        dlChar5x7(&frameList, screenWidth/2 -30, SCORE_ROW, sl, COLOR_WHITE, COLOR_BLACK);
+    if (sr != srShown || hudDamaged)
+        dlChar5x7(&frameList, screenWidth/2 +30, SCORE_ROW, sr, COLOR_WHITE, COLOR_BLACK);
+    slShown = sl;
+    srShown = sr;
+    hudDamaged = 0;
 }
 
 /*AUXILIARY METHOD FOR THE ASSEMBLY FUNCTION*/
 void lup() {
-    movLayerDraw(&pLU, &pl);
-    mlAdvance(&pLU,&fieldFence);
+    movLayerRecord(&pLU);
+    mlAdvanceClamped(&pLU,&fieldFence);
 }
 void ldw () {
-    movLayerDraw(&pLD, &pl);
-    mlAdvance(&pLD,&fieldFence);
+    movLayerRecord(&pLD);
+    mlAdvanceClamped(&pLD,&fieldFence);
 }
 void rup () {
-    movLayerDraw(&pRU, &pr);
-    mlAdvance(&pRU,&fieldFence);
+    movLayerRecord(&pRU);
+    mlAdvanceClamped(&pRU,&fieldFence);
 }
 void rdw () {
-    movLayerDraw(&pRD, &pr);
-    mlAdvance(&pRD,&fieldFence);
+    movLayerRecord(&pRD);
+    mlAdvanceClamped(&pRD,&fieldFence);
 }
 /*THIS METHOD DETECTS IF A BUTTON IS PRESSED
  TO MOVE A PADDLE UP OR DOWN RESPECTIVELY*/
 void moveC() {
     if (!(P2IN & BIT0)) {
-      movLayerDraw(&pLU, &pl);
-      mlAdvance(&pLU,&fieldFence);
+      movLayerRecord(&pLU);
+      mlAdvanceClamped(&pLU,&fieldFence);
     }
     if (!(P2IN & BIT1)) {
-        movLayerDraw(&pLD, &pl);
-        mlAdvance(&pLD,&fieldFence);
+        movLayerRecord(&pLD);
+        mlAdvanceClamped(&pLD,&fieldFence);
     }
     if (!(P2IN & BIT2)) {
-        movLayerDraw(&pRU, &pr);
-        mlAdvance(&pRU,&fieldFence);
+        movLayerRecord(&pRU);
+        mlAdvanceClamped(&pRU,&fieldFence);
     }
     if (!(P2IN & BIT3)) {
-        movLayerDraw(&pRD, &pr);
-        mlAdvance(&pRD,&fieldFence);
+        movLayerRecord(&pRD);
+        mlAdvanceClamped(&pRD,&fieldFence);
     }
     if ((!(P2IN & BIT0)) && (!(P2IN & BIT2)) && (!(P2IN & BIT3))) {
         WDTCTL = 0;  
@@ -0,0 +1,189 @@
+#include "shape.h"
+
+/* a shape's spans in successive rows, see rowSpans */
+typedef struct {
+  const AbShape *shape;
+  const Vec2 *pos;
+  u_char kind;			/* SHAPE_KIND_... */
+  int half;			/* table circles: half width in the last row, -1 at first */
+} RowSpanner;
+
+/* the shape's spans in row (rows must increase), or -1 if it has no row form */
+static int
+rowSpans(RowSpanner *r, int row, Span *spans)
+{
+  int col = r->pos->axes[0], absRow = row - r->pos->axes[1];
+  absRow = absRow < 0 ? -absRow : absRow;
+  switch (r->kind) {
+  case SHAPE_KIND_RECT:
+  case SHAPE_KIND_RECT_OUTLINE: {
+    const Vec2 *half = &((const AbRect *)r->shape)->halfSize;
+    if (absRow > half->axes[1])
+      return 0;
+    spans[0].colMin = col - half->axes[0];
+    spans[0].colMax = col + half->axes[0];
+    if (r->kind == SHAPE_KIND_RECT || absRow == half->axes[1])
+      return 1;
+    spans[1].colMin = spans[1].colMax = spans[0].colMax; /* left and right sides */
+    spans[0].colMax = spans[0].colMin;
+    return 2;
+  }
+  case SHAPE_KIND_RARROW: {	/* tip is to the left */
+    int size = ((const AbRArrow *)r->shape)->size, halfSize = size / 2;
+    if (absRow > halfSize)
+      return 0;
+    spans[0].colMin = col - (absRow <= halfSize / 2 ? size : halfSize);
+    spans[0].colMax = col - absRow;
+    return 1;
+  }
+  case SHAPE_KIND_CIRCLE: {	/* chords index cols: move the last row's edge */
+    const AbCircle *circle = (const AbCircle *)r->shape;
+    while (r->half < circle->radius && circle->chords[r->half + 1] >= absRow)
+      r->half++;
+    while (r->half >= 0 && circle->chords[r->half] < absRow)
+      r->half--;
+    if (absRow > circle->radius || r->half < 0)
+      return 0;
+    spans[0].colMin = col - r->half;
+    spans[0].colMax = col + r->half;
+    return 1;
+  }
+  case SHAPE_KIND_CIRCLE_INC: {
+    int half = circleIncHalfWidth(((const AbCircle *)r->shape)->radius, row - r->pos->axes[1]);
+    if (half < 0)
+      return 0;
+    spans[0].colMin = col - half;
+    spans[0].colMax = col + half;
+    return 1;
+  }
+  case SHAPE_KIND_SPANS:
+    return abSpanShapeGetSpans((const AbSpanShape *)r->shape, r->pos, row, spans);
+  default:
+    return -1;
+  }
+}
+
+/* is pixel, already within both shapes' spans, in both shapes?  Only
+   shapes without a row form (n < 0) need checking */
+static int
+pixelHit(const RowSpanner *a, int na, const RowSpanner *b, int nb, const Vec2 *pixel)
+{
+  return (na >= 0 || abShapeCheck(a->shape, a->pos, pixel)) &&
+    (nb >= 0 || abShapeCheck(b->shape, b->pos, pixel));
+}
+
+int
+abShapeCollide(const AbShape *a, const Vec2 *aPos, const AbShape *b, const Vec2 *bPos,
+	       Contact *contact)
+{
+  Region aBounds, bBounds, overlap;
+  int width, height, aCenter, bCenter;
+  RowSpanner aRows = {a, aPos, abShapeKind(a), -1}, bRows = {b, bPos, abShapeKind(b), -1};
+
+  /* broad phase: bounding boxes */
+  abShapeGetBounds(a, aPos, &aBounds);
+  abShapeGetBounds(b, bPos, &bBounds);
+  vec2Max(&overlap.topLeft, &aBounds.topLeft, &bBounds.topLeft);
+  vec2Min(&overlap.botRight, &aBounds.botRight, &bBounds.botRight);
+  if (overlap.topLeft.axes[0] > overlap.botRight.axes[0] ||
+      overlap.topLeft.axes[1] > overlap.botRight.axes[1])
+    return 0;
+
+  if (aRows.kind != SHAPE_KIND_RECT || bRows.kind != SHAPE_KIND_RECT) {
+    /* exact: intersect the shapes' spans in each row of overlap */
+    Region hits = {{32767, 32767}, {-32767, -32767}};
+    Span aSpans[SHAPE_MAX_SPANS], bSpans[SHAPE_MAX_SPANS];
+    Vec2 pixel;
+    for (pixel.axes[1] = overlap.topLeft.axes[1]; 
+	 pixel.axes[1] <= overlap.botRight.axes[1]; pixel.axes[1]++) {
+      int na = rowSpans(&aRows, pixel.axes[1], aSpans);
+      int nb = rowSpans(&bRows, pixel.axes[1], bSpans);
+      u_char i, j;
+      if (na < 0) {		/* no row form: check each pixel instead */
+	aSpans[0].colMin = overlap.topLeft.axes[0];
+	aSpans[0].colMax = overlap.botRight.axes[0];
+      }
+      if (nb < 0) {
+	bSpans[0].colMin = overlap.topLeft.axes[0];
+	bSpans[0].colMax = overlap.botRight.axes[0];
+      }
+      for (i = 0; i < (na < 0 ? 1 : na); i++) {
+	for (j = 0; j < (nb < 0 ? 1 : nb); j++) {
+	  int colMin = overlap.topLeft.axes[0], colMax = overlap.botRight.axes[0];
+	  if (colMin < aSpans[i].colMin) colMin = aSpans[i].colMin;
+	  if (colMin < bSpans[j].colMin) colMin = bSpans[j].colMin;
+	  if (colMax > aSpans[i].colMax) colMax = aSpans[i].colMax;
+	  if (colMax > bSpans[j].colMax) colMax = bSpans[j].colMax;
+	  for (pixel.axes[0] = colMin; pixel.axes[0] <= colMax; pixel.axes[0]++)
+	    if (pixelHit(&aRows, na, &bRows, nb, &pixel))
+	      break;		/* leftmost hit */
+	  if (pixel.axes[0] > colMax)
+	    continue;
+	  vec2Min(&hits.topLeft, &hits.topLeft, &pixel);
+	  vec2Max(&hits.botRight, &hits.botRight, &pixel);
+	  for (pixel.axes[0] = colMax; !pixelHit(&aRows, na, &bRows, nb, &pixel); pixel.axes[0]--)
+	    ;			/* rightmost hit */
+	  vec2Max(&hits.botRight, &hits.botRight, &pixel);
+	}
+      }
+    }
+    if (hits.topLeft.axes[0] > hits.botRight.axes[0])
+      return 0;			/* bounds touch, shapes don't */
+    overlap = hits;
+  }
+
+  if (contact) {
+    contact->overlap = overlap;
+    width = overlap.botRight.axes[0] - overlap.topLeft.axes[0] + 1;
+    height = overlap.botRight.axes[1] - overlap.topLeft.axes[1] + 1;
+    if (width <= height) {	/* shallower horizontally: a was hit on its left or right */
+      aCenter = aBounds.topLeft.axes[0] + aBounds.botRight.axes[0];
+      bCenter = bBounds.topLeft.axes[0] + bBounds.botRight.axes[0];
+      contact->side = (bCenter >= aCenter) ? COLLIDE_RIGHT : COLLIDE_LEFT;
+      contact->depth = width;
+    } else {
+      aCenter = aBounds.topLeft.axes[1] + aBounds.botRight.axes[1];
+      bCenter = bBounds.topLeft.axes[1] + bBounds.botRight.axes[1];
+      contact->side = (bCenter >= aCenter) ? COLLIDE_BOTTOM : COLLIDE_TOP;
+      contact->depth = height;
+    }
+  }
+  return 1;
+}
+
+int
+abShapeRegionCollide(const AbShape *a, const Vec2 *aPos, const Region *region,
+		     Contact *contact)
+{
+  Region bounds;
+  int beyond[5];		/* indexed by side */
+  u_char side, deepest = COLLIDE_NONE;
+  abShapeGetBounds(a, aPos, &bounds);
+  beyond[COLLIDE_LEFT] = region->topLeft.axes[0] - bounds.topLeft.axes[0];
+  beyond[COLLIDE_RIGHT] = bounds.botRight.axes[0] - region->botRight.axes[0];
+  beyond[COLLIDE_TOP] = region->topLeft.axes[1] - bounds.topLeft.axes[1];
+  beyond[COLLIDE_BOTTOM] = bounds.botRight.axes[1] - region->botRight.axes[1];
+  for (side = COLLIDE_LEFT; side <= COLLIDE_BOTTOM; side++)
+    if (beyond[side] > 0 && (deepest == COLLIDE_NONE || beyond[side] > beyond[deepest]))
+      deepest = side;
+  if (deepest == COLLIDE_NONE)
+    return 0;
+  if (contact) {
+    contact->side = deepest;
+    contact->depth = beyond[deepest];
+    contact->overlap = bounds;
+  }
+  return 1;
+}
+
+int
+layerCollide(const Layer *a, const Layer *b, Contact *contact)
+{
+  return abShapeCollide(a->abShape, &a->posNext, b->abShape, &b->posNext, contact);
+}
+
+int
+layerRegionCollide(const Layer *a, const Region *region, Contact *contact)
+{
+  return abShapeRegionCollide(a->abShape, &a->posNext, region, contact);
+}
@@ -0,0 +1,67 @@
+#include "libTimer.h"
+#include "lcdutils.h"
+#include "shape.h"
+
+void
+governorInit(Governor *g, u_int budget)
+{
+  g->budget = budget;
+  g->average = budget;
+  g->level = QUALITY_MAX;
+  g->streak = 0;
+  g->frame = 0;
+  g->frameStart = timerA1Read();
+}
+
+void
+governorFrameBegin(Governor *g)
+{
+  g->frameStart = timerA1Read();
+}
+
+u_char
+governorFrameEnd(Governor *g)
+{
+  u_int elapsed = timerA1Read() - g->frameStart; /* modulo 2**16 */
+  g->average = g->average - (g->average >> 2) + (elapsed >> 2);
+  g->frame++;
+  if (g->average > g->budget) {	/* running late: step down quickly */
+    g->streak = g->streak < 0 ? g->streak - 1 : -1;
+    if (g->streak <= -GOVERNOR_DOWN_FRAMES && g->level > QUALITY_MIN) {
+      g->level--;
+      g->streak = 0;
+    }
+  } else if (g->average < g->budget - (g->budget >> 2)) { /* room to spare */
+    g->streak = g->streak > 0 ? g->streak + 1 : 1;
+    if (g->streak >= GOVERNOR_UP_FRAMES && g->level < QUALITY_MAX) {
+      g->level++;
+      g->streak = 0;
+    }
+  } else			/* near budget: hold */
+    g->streak = 0;
+  return g->level;
+}
+
+u_char
+governorParticleCap(const Governor *g)
+{
+  return PARTICLE_MAX * (g->level + 1) / (QUALITY_MAX + 1);
+}
+
+u_int
+governorMergeSlack(const Governor *g)
+{
+  return g->level == QUALITY_MAX ? 0 : 64 << (2 * (QUALITY_MAX - 1 - g->level));
+}
+
+int
+governorLowRes(const Governor *g)
+{
+  return g->level < 2;
+}
+
+int
+governorHudDue(const Governor *g)
+{
+  return !(g->frame & ((1 << (QUALITY_MAX - g->level)) - 1));
+}
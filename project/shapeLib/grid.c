@@ -0,0 +1,143 @@
+#include "lcdutils.h"
+#include "shape.h"
+
+#define NO_CELL 0xff		/* span col0 for a layer that is off screen */
+
+static int
+cellOf(int coord, int cells)
+{
+  if (coord < 0)
+    return 0;
+  coord >>= GRID_CELL_SHIFT;
+  return coord < cells ? coord : cells - 1;
+}
+
+/* cells covered by region, as col0, row0, col1, row1 */
+static void
+regionCells(const Region *region, u_char span[4])
+{
+  if (region->botRight.axes[0] < 0 || region->botRight.axes[1] < 0 ||
+      region->topLeft.axes[0] >= screenWidth || region->topLeft.axes[1] >= screenHeight ||
+      region->topLeft.axes[0] > region->botRight.axes[0] ||
+      region->topLeft.axes[1] > region->botRight.axes[1]) {
+    span[0] = NO_CELL;
+    return;
+  }
+  span[0] = cellOf(region->topLeft.axes[0], GRID_COLS);
+  span[1] = cellOf(region->topLeft.axes[1], GRID_ROWS);
+  span[2] = cellOf(region->botRight.axes[0], GRID_COLS);
+  span[3] = cellOf(region->botRight.axes[1], GRID_ROWS);
+}
+
+static void
+layerCells(const Layer *l, u_char span[4])
+{
+  Region bounds;
+  layerGetCurrentBounds(l, &bounds);
+  regionCells(&bounds, span);
+}
+
+/* set (or clear) bit in every cell of span */
+static void
+markCells(LayerGrid *grid, const u_char span[4], GridMask bit, int set)
+{
+  u_char row, col;
+  if (span[0] == NO_CELL)
+    return;
+  for (row = span[1]; row <= span[3]; row++)
+    for (col = span[0]; col <= span[2]; col++)
+      if (set)
+	grid->cells[row][col] |= bit;
+      else
+	grid->cells[row][col] &= ~bit;
+}
+
+void
+layerGridInit(LayerGrid *grid, Layer *layers)
+{
+  u_char row, col, i;
+  for (row = 0; row < GRID_ROWS; row++)
+    for (col = 0; col < GRID_COLS; col++)
+      grid->cells[row][col] = 0;
+  for (i = 0; layers && i < GRID_MAX_LAYERS; i++, layers = layers->next) {
+    grid->layers[i] = layers;
+    layerCells(layers, grid->span[i]);
+    markCells(grid, grid->span[i], 1 << i, 1);
+  }
+  grid->numLayers = i;
+}
+
+void
+layerGridUpdate(LayerGrid *grid)
+{
+  u_char i, j, span[4];
+  for (i = 0; i < grid->numLayers; i++) {
+    u_char *old = grid->span[i];
+    layerCells(grid->layers[i], span);
+    if (span[0] == old[0] && span[1] == old[1] && span[2] == old[2] && span[3] == old[3])
+      continue;			/* still in the same cells */
+    markCells(grid, old, 1 << i, 0);
+    markCells(grid, span, 1 << i, 1);
+    for (j = 0; j < 4; j++)
+      old[j] = span[j];
+  }
+}
+
+GridMask
+layerGridQuery(const LayerGrid *grid, const Region *region)
+{
+  u_char row, col, span[4];
+  GridMask found = 0;
+  regionCells(region, span);
+  if (span[0] == NO_CELL)
+    return 0;
+  for (row = span[1]; row <= span[3]; row++)
+    for (col = span[0]; col <= span[2]; col++)
+      found |= grid->cells[row][col];
+  return found;
+}
+
+GridMask
+layerGridNeighbors(const LayerGrid *grid, const Layer *layer)
+{
+  u_char row, col, i;
+  GridMask found = 0;
+  for (i = 0; i < grid->numLayers; i++)
+    if (grid->layers[i] == layer)
+      break;
+  if (i == grid->numLayers || grid->span[i][0] == NO_CELL)
+    return 0;
+  for (row = grid->span[i][1]; row <= grid->span[i][3]; row++)
+    for (col = grid->span[i][0]; col <= grid->span[i][2]; col++)
+      found |= grid->cells[row][col];
+  return found & ~(1 << i);
+}
+
+extern GridMask layerGridMask;	/* see layer.c */
+
+void
+layerGridDraw(LayerGrid *grid, const Region *area)
+{
+  u_char cellRow, cellCol, span[4];
+  Layer *layers = grid->numLayers ? grid->layers[0] : 0;
+  int complete = !layers || !grid->layers[grid->numLayers - 1]->next;
+  layerGridUpdate(grid);
+  regionCells(area, span);
+  if (!complete || span[0] == NO_CELL) {
+    layerDrawRegion(layers, area); /* too many layers to index: probe them all */
+    return;
+  }
+  for (cellRow = span[1]; cellRow <= span[3]; cellRow++)
+    for (cellCol = span[0]; cellCol <= span[2]; cellCol++) {
+      Region tile;		/* part of area within this cell */
+      tile.topLeft.axes[0] = cellCol << GRID_CELL_SHIFT;
+      tile.topLeft.axes[1] = cellRow << GRID_CELL_SHIFT;
+      tile.botRight.axes[0] = tile.topLeft.axes[0] + (1 << GRID_CELL_SHIFT) - 1;
+      tile.botRight.axes[1] = tile.topLeft.axes[1] + (1 << GRID_CELL_SHIFT) - 1;
+      vec2Max(&tile.topLeft, &tile.topLeft, &area->topLeft);
+      vec2Min(&tile.botRight, &tile.botRight, &area->botRight);
+      layerGridMask = grid->cells[cellRow][cellCol];
+      layerDrawRegion(layers, &tile);
+    }
+  layerGridMask = (GridMask)~0;
+}
@@ -5,40 +5,408 @@
 void
 layerDraw(Layer *layers)
 {
-  int row, col;
-  for (row = 0; row < screenHeight; row++) {
-    lcd_setArea(0, row, screenWidth-1, row);
-    for (col = 0; col < screenWidth; col++) {
+  Region screen = {{0, 0}, {screenWidth-1, screenHeight-1}};
+  layerDrawRegion(layers, &screen);
+} 
+
+
+
+/* does layer l contain pixel?  Known kinds are checked inline, others through check */
+static inline int
+layerCheck(const Layer *l, const Vec2 *pixel)
+{
+  int col = pixel->axes[0] - l->pos.axes[0], row = pixel->axes[1] - l->pos.axes[1];
+  switch (l->kind) {
+  case SHAPE_KIND_RECT: {
+    const Vec2 *half = &((const AbRect *)l->abShape)->halfSize;
+    return col <= half->axes[0] && -col <= half->axes[0] &&
+      row <= half->axes[1] && -row <= half->axes[1];
+  }
+  case SHAPE_KIND_RECT_OUTLINE: {
+    const Vec2 *half = &((const AbRect *)l->abShape)->halfSize;
+    col = col < 0 ? -col : col;
+    row = row < 0 ? -row : row;
+    return (col == half->axes[0] && row <= half->axes[1]) ||
+      (row == half->axes[1] && col <= half->axes[0]);
+  }
+  case SHAPE_KIND_RARROW: {
+    int size = ((const AbRArrow *)l->abShape)->size, halfSize = size / 2;
+    col = -col;
+    row = row < 0 ? -row : row;
+    if (col < 0)
+      return 0;
+    if (col <= halfSize)
+      return row <= col;
+    return col <= size && row <= halfSize / 2;
+  }
+  case SHAPE_KIND_CIRCLE: {
+    const AbCircle *circle = (const AbCircle *)l->abShape;
+    col = col < 0 ? -col : col;
+    row = row < 0 ? -row : row;
+    return col <= circle->radius && circle->chords[col] >= row;
+  }
+  case SHAPE_KIND_CIRCLE_INC:	/* drawPlanRow finds whole spans when it can */
+    return circleIncContains(((const AbCircle *)l->abShape)->radius, col, row);
+  default:
+    return abShapeCheck(l->abShape, &l->pos, pixel);
+  }
+}
+
+#define DRAW_MAX_CANDIDATES 8
+#define LOWRES_MAX_RUNS 8	/* color runs remembered to repeat a low-res row */
+#define NO_RANK 0xff
+#define DRAW_MAX_ROW_SPANS 8	/* spans of span-drawn candidates in a row */
+#define NO_SPANS 0xff
+
+extern const StaticLayerCache *layerStaticCache; /* see layerStaticInit */
+GridMask layerGridMask = (GridMask)~0;	/* layers of the cell being drawn, see layerGridDraw */
+
+/* true if inner lies within outer */
+static int
+regionContains(const Region *outer, const Region *inner)
+{
+  return inner->topLeft.axes[0] >= outer->topLeft.axes[0] &&
+    inner->topLeft.axes[1] >= outer->topLeft.axes[1] &&
+    inner->botRight.axes[0] <= outer->botRight.axes[0] &&
+    inner->botRight.axes[1] <= outer->botRight.axes[1];
+}
+
+/* what's needed to color the pixels of an area, see drawPlanInit */
+typedef struct {
+  Layer *layers;
+  Layer *candidates[DRAW_MAX_CANDIDATES];
+  u_char ranks[DRAW_MAX_CANDIDATES];
+  u_char numCandidates;
+  u_char probeAll;		/* too many candidates: probe every layer */
+  const StaticLayerCache *cache;
+  const StaticRowRun *run, *lastRun;
+  const StaticSpan *span, *spanEnd; /* static spans of current row */
+  Span rowSpans[DRAW_MAX_ROW_SPANS]; /* current row's spans of span-drawn candidates */
+  u_char firstSpan[DRAW_MAX_CANDIDATES];
+  u_char numSpans[DRAW_MAX_CANDIDATES]; /* NO_SPANS: probe with layerCheck */
+} DrawPlan;
+
+/* does candidate i contain pixel (in the current row)? */
+static inline int
+planCheck(const DrawPlan *plan, u_char i, const Vec2 *pixelPos)
+{
+  u_char n = plan->numSpans[i];
+  const Span *span;
+  int col = pixelPos->axes[0];
+  if (n == NO_SPANS)
+    return layerCheck(plan->candidates[i], pixelPos);
+  for (span = plan->rowSpans + plan->firstSpan[i]; n; n--, span++)
+    if (col >= span->colMin && col <= span->colMax)
+      return 1;
+  return 0;
+}
+
+/* color of the first candidate above rankLimit to contain pixelPos */
+static u_int
+probeColor(const DrawPlan *plan, u_char rankLimit, const Vec2 *pixelPos, u_int color)
+{
+  u_char i;
+  for (i = 0; i < plan->numCandidates && plan->ranks[i] < rankLimit; i++) {
+    if (planCheck(plan, i, pixelPos))
+      return plan->candidates[i]->color;
+  }
+  return color;
+}
+
+/* list the layers that may show in area, in order */
+static void
+drawPlanInit(DrawPlan *plan, Layer *layers, const Region *area)
+{
+  u_char rank = 0;
+  Layer *probeLayer;
+  const StaticLayerCache *cache = 
+    (layerStaticCache && layerStaticCache->layers == layers) ? layerStaticCache : 0;
+
+  Region occluder;		/* largest solid interior above, clipped to area */
+  long occluderArea = 0;
+
+  plan->layers = layers;
+  plan->numCandidates = 0;
+  for (probeLayer = layers; probeLayer; probeLayer = probeLayer->next, rank++) {
+    Region bounds, interior;
+    if (cache && (probeLayer->flags & LAYER_STATIC))
+      continue;			/* looked up in cache instead */
+    if (rank < GRID_MAX_LAYERS && !(layerGridMask & (1 << rank)))
+      continue;			/* not in this grid cell */
+    layerGetCurrentBounds(probeLayer, &bounds);
+    vec2Max(&bounds.topLeft, &bounds.topLeft, &area->topLeft);
+    vec2Min(&bounds.botRight, &bounds.botRight, &area->botRight);
+    if (bounds.topLeft.axes[0] > bounds.botRight.axes[0] ||
+	bounds.topLeft.axes[1] > bounds.botRight.axes[1])
+      continue;			/* can't cover any pixel of area */
+    if (occluderArea && regionContains(&occluder, &bounds))
+      continue;			/* hidden behind an upper layer */
+    if (plan->numCandidates == DRAW_MAX_CANDIDATES)
+      break;			/* too many to list */
+    plan->ranks[plan->numCandidates] = rank;
+    plan->candidates[plan->numCandidates++] = probeLayer;
+
+    if (abShapeGetInterior(probeLayer->abShape, &probeLayer->pos, &interior)) {
+      long interiorArea;
+      vec2Max(&interior.topLeft, &interior.topLeft, &area->topLeft);
+      vec2Min(&interior.botRight, &interior.botRight, &area->botRight);
+      interiorArea = (long)(interior.botRight.axes[0] - interior.topLeft.axes[0] + 1) *
+	(interior.botRight.axes[1] - interior.topLeft.axes[1] + 1);
+      if (interior.topLeft.axes[0] <= interior.botRight.axes[0] &&
+	  interior.topLeft.axes[1] <= interior.botRight.axes[1] &&
+	  interiorArea > occluderArea) {
+	occluder = interior;
+	occluderArea = interiorArea;
+      }
+    }
+  }
+  plan->probeAll = probeLayer != 0;
+  if (plan->probeAll)		/* probe every layer, in order */
+    cache = 0;
+  plan->cache = cache;
+  plan->span = plan->spanEnd = 0;
+  if (cache) {
+    plan->run = cache->rowRuns;
+    plan->lastRun = plan->run + cache->numRowRuns - 1;
+  }
+}
+
+/* start a row (rows must not decrease): find static spans, and the
+   spans of candidates cheaper to find a row at a time than a pixel at a time */
+static void
+drawPlanRow(DrawPlan *plan, int row)
+{
+  u_char i, used = 0;
+  for (i = 0; i < plan->numCandidates; i++) {
+    const Layer *l = plan->candidates[i];
+    plan->numSpans[i] = NO_SPANS;
+    if (l->kind == SHAPE_KIND_CIRCLE_INC && used < DRAW_MAX_ROW_SPANS) {
+      int half = circleIncHalfWidth(((const AbCircle *)l->abShape)->radius,
+				    row - l->pos.axes[1]);
+      plan->firstSpan[i] = used;
+      plan->numSpans[i] = 0;
+      if (half >= 0) {
+	plan->rowSpans[used].colMin = l->pos.axes[0] - half;
+	plan->rowSpans[used++].colMax = l->pos.axes[0] + half;
+	plan->numSpans[i] = 1;
+      }
+    } else if (l->kind == SHAPE_KIND_SPANS &&
+	       used + SHAPE_MAX_SPANS <= DRAW_MAX_ROW_SPANS) {
+      plan->firstSpan[i] = used;
+      plan->numSpans[i] = abSpanShapeGetSpans((const AbSpanShape *)l->abShape,
+					      &l->pos, row, plan->rowSpans + used);
+      used += plan->numSpans[i];
+    }
+  }
+  if (plan->cache) {
+    const StaticRowRun *run = plan->run;
+    while (run->rowMax < row && run < plan->lastRun)
+      run++;
+    plan->run = run;
+    plan->span = plan->cache->spans + run->firstSpan;
+    plan->spanEnd = plan->span + run->numSpans;
+  }
+}
+
+/* color of pixel in current row (cols must not decrease within a row) */
+static inline u_int
+drawPlanColor(DrawPlan *plan, const Vec2 *pixelPos)
+{
+  int col = pixelPos->axes[0];
+  u_int color = bgColor;
+  u_char staticRank = NO_RANK;
+  const StaticSpan *span = plan->span;
+  if (span) {			/* static layer here? */
+    while (span < plan->spanEnd && span->colMax < col)
+      span++;
+    plan->span = span;
+    if (span < plan->spanEnd && span->colMin <= col) {
+      color = plan->cache->statics[span->layer]->color;
+      staticRank = plan->cache->rank[span->layer];
+    }
+  }
+  if (!plan->probeAll) {
+    color = probeColor(plan, staticRank, pixelPos, color);
+  } else {			/* probe all layers, in order */
+    Layer *l;
+    for (l = plan->layers; l; l = l->next) {
+      if (layerCheck(l, pixelPos)) {
+	color = l->color;
+	break;
+      }
+    }
+  }
+  return color;
+}
+
+/* draw every rowStep'th row of area, starting with its top row */
+static void
+drawRows(Layer *layers, const Region *area, u_char rowStep)
+{
+  int row, col, last = -1;
+  DrawPlan plan;
+  drawPlanInit(&plan, layers, area);
+  for (row = area->topLeft.axes[1]; row <= area->botRight.axes[1]; row += rowStep) {
+    if (rowStep != 1)		/* only the column range is cached */
+      lcd_setArea(area->topLeft.axes[0], row, area->botRight.axes[0], row);
+    else if (row > last)	/* one window for the rest of the area (unless scrolling splits it) */
+      last = lcd_setArea(area->topLeft.axes[0], row,
+			 area->botRight.axes[0], area->botRight.axes[1]);
+    drawPlanRow(&plan, row);
+    for (col = area->topLeft.axes[0]; col <= area->botRight.axes[0]; col++) {
       Vec2 pixelPos = {col, row};
-      u_int color = bgColor;
-      Layer *probeLayer;
-      for (probeLayer = layers; probeLayer; probeLayer = probeLayer->next) {
-	if (abShapeCheck(probeLayer->abShape, &probeLayer->pos, &pixelPos)) {
-	  color = probeLayer->color;
-	  break; 
-	} /* if check */
-      } // for checking all layers at col, row
-      lcd_writeColor(color); 
+      lcd_writeColor(drawPlanColor(&plan, &pixelPos));
     } // for col
   } // for row
-} 
+}
+
+void
+layerDrawRegion(Layer *layers, const Region *area)
+{
+  drawRows(layers, area, 1);
+}
+
+void
+layerDrawJobBegin(LayerDrawJob *job, Layer *layers, const Region *area, u_char interlaced)
+{
+  job->layers = layers;
+  job->area = *area;
+  job->row = area->topLeft.axes[1];
+  job->rowStep = interlaced ? 2 : 1;
+}
+
+int
+layerDrawJobRun(LayerDrawJob *job, u_char maxRows)
+{
+  int top = job->area.topLeft.axes[1], bottom = job->area.botRight.axes[1];
+  Region slice = job->area;
+  if (job->row > bottom || !maxRows)
+    return job->row <= bottom;
+  slice.topLeft.axes[1] = job->row;
+  slice.botRight.axes[1] = job->row + (maxRows - 1) * job->rowStep;
+  if (slice.botRight.axes[1] > bottom)
+    slice.botRight.axes[1] = bottom;
+  drawRows(job->layers, &slice, job->rowStep);
+  job->row += maxRows * job->rowStep;
+  if (job->row > bottom && job->rowStep == 2 && !((job->row - top) & 1))
+    job->row = top + 1;		/* even rows done: odd rows next */
+  return job->row <= bottom;
+}
 
+void
+layerDrawLowRes(Layer *layers)
+{
+  Region screen = {{0, 0}, {screenWidth-1, screenHeight-1}};
+  layerDrawRegionLowRes(layers, &screen);
+}
 
+/* a run of identical colors within a pixel-doubled row */
+typedef struct {
+  u_int color;
+  u_char width;			/* in physical pixels */
+} LowResRun;
+
+void
+layerDrawRegionLowRes(Layer *layers, const Region *area)
+{
+  int row, col, colMin, colMax, last = -1;
+  u_char half, numRuns, i;
+  DrawPlan plan;
+  LowResRun runs[LOWRES_MAX_RUNS];
+  Region blocks = *area;	/* area grown to whole 2x2 blocks */
+  blocks.topLeft.axes[0] &= ~1;
+  blocks.topLeft.axes[1] &= ~1;
+  blocks.botRight.axes[0] |= 1;
+  blocks.botRight.axes[1] |= 1;
+  regionClipScreen(&blocks);
+  colMin = blocks.topLeft.axes[0];
+  colMax = blocks.botRight.axes[0];
+
+  drawPlanInit(&plan, layers, &blocks);
+  for (row = blocks.topLeft.axes[1]; row <= blocks.botRight.axes[1]; row += 2) {
+    numRuns = 0;
+    for (half = 0; half < 2; half++) { /* each logical row fills 2 physical rows */
+      if (row + half > last)	/* one window for the rest (unless scrolling splits it) */
+	last = lcd_setArea(colMin, row + half, colMax, blocks.botRight.axes[1]);
+      if (half && numRuns <= LOWRES_MAX_RUNS) { /* repeat the row just sent */
+	for (i = 0; i < numRuns; i++) {
+	  u_char width = runs[i].width;
+	  while (width--)
+	    lcd_writeColor(runs[i].color);
+	}
+	continue;
+      }
+      drawPlanRow(&plan, row);	/* sample block's top-left pixel */
+      for (col = colMin; col <= colMax; col += 2) {
+	Vec2 pixelPos = {col, row};
+	u_int color = drawPlanColor(&plan, &pixelPos);
+	lcd_writeColor(color);
+	if (col < colMax)
+	  lcd_writeColor(color);
+	if (half)
+	  continue;
+	if (numRuns && numRuns <= LOWRES_MAX_RUNS && runs[numRuns-1].color == color) {
+	  runs[numRuns-1].width += (col < colMax) ? 2 : 1;
+	} else if (numRuns++ < LOWRES_MAX_RUNS) {
+	  runs[numRuns-1].color = color;
+	  runs[numRuns-1].width = (col < colMax) ? 2 : 1;
+	}
+      }
+    }
+  }
+}
+
+u_int
+layerColorAt(Layer *layers, const Vec2 *pixel)
+{
+  for (; layers; layers = layers->next)
+    if (layerCheck(layers, pixel))
+      return layers->color;
+  return bgColor;
+}
+
+void
+layerGetCurrentBounds(const Layer *l, Region *bounds)
+{
+  if (l->flags & LAYER_BOUNDS_VALID)
+    *bounds = l->bounds;
+  else
+    abShapeGetBounds(l->abShape, &l->pos, bounds);
+}
 
 void
 layerGetBounds(const Layer *l, Region *bounds)
 {
-  Region lastBounds, curBounds;
-  abShapeGetBounds(l->abShape, &l->posLast, &lastBounds);
-  abShapeGetBounds(l->abShape, &l->pos, &curBounds);
-  regionUnion(bounds, &curBounds, &lastBounds);
+  if (l->flags & LAYER_BOUNDS_VALID) {
+    *bounds = l->bounds;
+    if (l->flags & LAYER_MOVED) { /* else posLast is pos */
+      Region lastBounds;
+      abShapeGetBounds(l->abShape, &l->posLast, &lastBounds);
+      regionUnion(bounds, bounds, &lastBounds);
+    }
+  } else {
+    Region lastBounds, curBounds;
+    abShapeGetBounds(l->abShape, &l->posLast, &lastBounds);
+    abShapeGetBounds(l->abShape, &l->pos, &curBounds);
+    regionUnion(bounds, &curBounds, &lastBounds);
+  }
   regionClipScreen(bounds);
 }
 
 void
 layerInit(Layer *layer)
 {
-  for (; layer; layer = layer->next)
+  for (; layer; layer = layer->next) {
     layer->posLast = layer->posNext = layer->pos;
+    abShapeGetBounds(layer->abShape, &layer->pos, &layer->bounds);
+    layer->flags = (layer->flags & ~LAYER_MOVED) | LAYER_BOUNDS_VALID;
+    layer->kind = abShapeKind(layer->abShape);
+  }
 }
 
+void
+layerInvalidate(Layer *l)
+{
+  l->flags &= ~LAYER_BOUNDS_VALID;
+  l->kind = abShapeKind(l->abShape);
+}
@@ -0,0 +1,93 @@
+#include "lcdutils.h"
+#include "shape.h"
+
+#define NO_LAYER 0xff
+
+const StaticLayerCache *layerStaticCache; /* used by layerDrawRegion */
+
+/* the first static layer (index into cache->statics) containing pixelPos */
+static u_char
+staticAt(const StaticLayerCache *cache, u_char numStatics, const Vec2 *pixelPos)
+{
+  u_char i;
+  for (i = 0; i < numStatics; i++) {
+    Layer *l = cache->statics[i];
+    if (abShapeCheck(l->abShape, &l->pos, pixelPos))
+      return i;
+  }
+  return NO_LAYER;
+}
+
+int
+layerStaticInit(StaticLayerCache *cache, Layer *layers)
+{
+  u_char numStatics = 0, numSpans = 0, rank = 0;
+  int row, col;
+  Region extent;		/* union of static layers' bounds */
+  Layer *l;
+
+  layerStaticCache = 0;
+  cache->layers = layers;
+  cache->numRowRuns = 0;
+  for (l = layers; l; l = l->next, rank++) {
+    Region bounds;
+    if (!(l->flags & LAYER_STATIC))
+      continue;
+    if (numStatics == STATIC_MAX_LAYERS)
+      return 0;
+    abShapeGetBounds(l->abShape, &l->pos, &bounds);
+    if (numStatics)
+      regionUnion(&extent, &extent, &bounds);
+    else
+      extent = bounds;
+    cache->statics[numStatics] = l;
+    cache->rank[numStatics++] = rank;
+  }
+  if (!numStatics)
+    return 0;
+  regionClipScreen(&extent);
+
+  for (row = 0; row < screenHeight; row++) {
+    u_char firstSpan = numSpans, current = NO_LAYER;
+    StaticRowRun *run = &cache->rowRuns[cache->numRowRuns];
+    if (row >= extent.topLeft.axes[1] && row <= extent.botRight.axes[1]) {
+      for (col = extent.topLeft.axes[0]; col <= extent.botRight.axes[0] && col < screenWidth; col++) {
+	Vec2 pixelPos = {col, row};
+	u_char i = staticAt(cache, numStatics, &pixelPos);
+	if (i == current && i != NO_LAYER) {
+	  cache->spans[numSpans-1].colMax = col; /* extend span */
+	} else if (i != NO_LAYER) {
+	  if (numSpans == STATIC_MAX_SPANS)
+	    return 0;
+	  cache->spans[numSpans].colMin = cache->spans[numSpans].colMax = col;
+	  cache->spans[numSpans++].layer = i;
+	}
+	current = i;
+      } // for col
+    }
+    if (cache->numRowRuns) {	/* same spans as the previous run? */
+      StaticRowRun *prev = run - 1;
+      u_char n = numSpans - firstSpan, i;
+      if (prev->numSpans == n) {
+	for (i = 0; i < n; i++) {
+	  StaticSpan *a = &cache->spans[prev->firstSpan + i], *b = &cache->spans[firstSpan + i];
+	  if (a->colMin != b->colMin || a->colMax != b->colMax || a->layer != b->layer)
+	    break;
+	}
+	if (i == n) {
+	  prev->rowMax = row;
+	  numSpans = firstSpan;
+	  continue;
+	}
+      }
+    }
+    if (cache->numRowRuns == STATIC_MAX_ROW_RUNS)
+      return 0;
+    run->rowMax = row;
+    run->firstSpan = firstSpan;
+    run->numSpans = numSpans - firstSpan;
+    cache->numRowRuns++;
+  } // for row
+  layerStaticCache = cache;
+  return 1;
+}
@@ -0,0 +1,132 @@
+#include <libTimer.h>
+#include "shape.h"
+
+void
+mlStep(MovLayer *ml, Vec2 *step)
+{
+  u_char axis;
+  for (axis = 0; axis < 2; axis++) {
+    int sum = ml->frac[axis] + ml->velocity.axes[axis];
+    step->axes[axis] = sum >> 8; /* floor, also for negative sums */
+    ml->frac[axis] = sum & 0xff;
+  }
+}
+
+void
+mlLaunch(MovLayer *ml, u_char angle, int speed)
+{
+  ml->velocity.axes[0] = ((long)speed * cosQ8(angle)) >> 8;
+  ml->velocity.axes[1] = ((long)speed * sinQ8(angle)) >> 8;
+}
+
+void
+mlReflect(MovLayer *ml, u_char side)
+{
+  u_char axis = (side == COLLIDE_LEFT || side == COLLIDE_RIGHT) ? 0 : 1;
+  int into = (side == COLLIDE_RIGHT || side == COLLIDE_BOTTOM) ? 1 : -1;
+  if (ml->velocity.axes[axis] * into > 0)
+    ml->velocity.axes[axis] = -ml->velocity.axes[axis];
+  ml->frac[axis] = 0;	/* stopped on a whole pixel */
+}
+
+/* one step of ml within fence; returns the side that hit it, if any */
+static u_char
+mlFenceStep(MovLayer *ml, const Region *fence)
+{
+  Vec2 step;
+  Impact impact;
+  Layer *l = ml->layer;
+  mlStep(ml, &step);
+  if (abShapeSweepRegion(l->abShape, &l->posNext, &step, fence, &impact)) {
+    u_char axis = (impact.side == COLLIDE_LEFT || impact.side == COLLIDE_RIGHT) ? 0 : 1;
+    l->posNext = impact.pos;
+    ml->frac[axis] = 0;	/* stopped on a whole pixel */
+    return impact.side;
+  }
+  vec2Add(&l->posNext, &l->posNext, &step);
+  return COLLIDE_NONE;
+}
+
+void
+mlAdvance(MovLayer *ml, const Region *fence)
+{
+  for (; ml; ml = ml->next) {
+    u_char side = mlFenceStep(ml, fence);
+    if (side != COLLIDE_NONE)
+      mlReflect(ml, side);
+  }
+}
+
+void
+mlAdvanceClamped(MovLayer *ml, const Region *fence)
+{
+  for (; ml; ml = ml->next)
+    mlFenceStep(ml, fence);
+}
+
+void
+movLayerCommit(MovLayer *movLayers)
+{
+  MovLayer *movLayer;
+  and_sr(~8);			/* disable interrupts (GIE off) */
+  for (movLayer = movLayers; movLayer; movLayer = movLayer->next) {
+    Layer *l = movLayer->layer;
+    if (l->pos.axes[0] != l->posNext.axes[0] || l->pos.axes[1] != l->posNext.axes[1] ||
+	!(l->flags & LAYER_BOUNDS_VALID))
+      l->flags |= LAYER_MOVED;
+    else
+      l->flags &= ~LAYER_MOVED;
+    l->posLast = l->pos;
+    l->pos = l->posNext;
+  }
+  or_sr(8);			/* enable interrupts (GIE on) */
+
+  for (movLayer = movLayers; movLayer; movLayer = movLayer->next) {
+    Layer *l = movLayer->layer;
+    if (l->flags & LAYER_MOVED)	/* also set if bounds weren't valid */
+      abShapeGetBounds(l->abShape, &l->pos, &l->bounds);
+    l->flags |= LAYER_BOUNDS_VALID;
+  }
+}
+
+void
+movLayerDraw(MovLayer *movLayers, Layer *layers)
+{
+  MovLayer *movLayer;
+  movLayerCommit(movLayers);
+  for (movLayer = movLayers; movLayer; movLayer = movLayer->next) {
+    Region bounds;
+    if (!(movLayer->layer->flags & LAYER_MOVED))
+      continue;			/* nothing to redraw */
+    layerGetBounds(movLayer->layer, &bounds);
+    layerDrawRegion(layers, &bounds);
+  }
+}
+
+#define MERGE_MAX_REGIONS 4
+
+void
+movLayerDrawMerged(MovLayer *movLayers, Layer *layers, u_int slack)
+{
+  Region dirty[MERGE_MAX_REGIONS];
+  u_char numDirty = 0, i;
+  MovLayer *movLayer;
+  movLayerCommit(movLayers);
+  for (movLayer = movLayers; movLayer; movLayer = movLayer->next) {
+    Region bounds;
+    if (!(movLayer->layer->flags & LAYER_MOVED))
+      continue;			/* nothing to redraw */
+    layerGetBounds(movLayer->layer, &bounds);
+    for (i = 0; i < numDirty; i++)
+      if (regionMerge(&dirty[i], &bounds, slack))
+	break;
+    if (i < numDirty)
+      continue;			/* merged */
+    if (numDirty < MERGE_MAX_REGIONS)
+      dirty[numDirty++] = bounds;
+    else			/* no room left */
+      regionUnion(&dirty[numDirty - 1], &dirty[numDirty - 1], &bounds);
+  }
+  for (i = 0; i < numDirty; i++)
+    layerDrawRegion(layers, &dirty[i]);
+}
@@ -0,0 +1,102 @@
+#include <libTimer.h>
+#include "lcdutils.h"
+#include "lcddraw.h"
+#include "shape.h"
+
+void
+particleInit(ParticlePool *pool)
+{
+  u_char i;
+  for (i = 0; i < PARTICLE_MAX; i++) {
+    pool->life[i] = 0;
+    pool->drawnCol[i] = PARTICLE_NOT_DRAWN;
+  }
+  pool->cap = PARTICLE_MAX;
+}
+
+int
+particleEmit(ParticlePool *pool, const Vec2 *pos, u_char angle, int speed,
+	     u_char life, u_int color)
+{
+  u_char i;
+  if (pos->axes[0] < 0 || pos->axes[0] >= screenWidth ||
+      pos->axes[1] < 0 || pos->axes[1] >= screenHeight)
+    return 0;			/* off screen */
+  for (i = 0; i < pool->cap && i < PARTICLE_MAX; i++) {
+    if (pool->life[i] || pool->drawnCol[i] != PARTICLE_NOT_DRAWN)
+      continue;			/* busy, or still on screen */
+    pool->x[i] = ((u_int)pos->axes[0] << 8) + 128; /* middle of the pixel */
+    pool->y[i] = ((u_int)pos->axes[1] << 8) + 128;
+    pool->vx[i] = ((long)speed * cosQ8(angle)) >> 8;
+    pool->vy[i] = ((long)speed * sinQ8(angle)) >> 8;
+    pool->color[i] = color;
+    pool->life[i] = life;
+    return 1;
+  }
+  return 0;
+}
+
+void
+particleBurst(ParticlePool *pool, const Vec2 *pos, u_char count, int speed,
+	      u_char life, u_int color)
+{
+  u_int angle = 0, step = count ? 256 / count : 0;
+  for (; count; count--, angle += step)
+    if (!particleEmit(pool, pos, angle, speed, life, color))
+      break;
+}
+
+void
+particleAdvance(ParticlePool *pool, int gravity)
+{
+  u_char i;
+  for (i = 0; i < PARTICLE_MAX; i++) {
+    if (!pool->life[i])
+      continue;
+    pool->vy[i] += gravity;
+    pool->x[i] += pool->vx[i];
+    pool->y[i] += pool->vy[i];
+    pool->life[i]--;
+    /* unsigned: leaving past col or row 0 wraps to a huge position */
+    if ((pool->x[i] >> 8) >= screenWidth || (pool->y[i] >> 8) >= screenHeight)
+      pool->life[i] = 0;	/* left the screen */
+  }
+}
+
+void
+particleDraw(ParticlePool *pool, Layer *layers)
+{
+  PlotPoint points[2 * PARTICLE_MAX]; /* erasures first, so draws win */
+  u_char col[PARTICLE_MAX], row[PARTICLE_MAX], live[PARTICLE_MAX];
+  u_int count = 0;
+  u_char i;
+
+  and_sr(~8);			/* disable interrupts (GIE off) */
+  for (i = 0; i < PARTICLE_MAX; i++) {
+    live[i] = pool->life[i] != 0;
+    col[i] = pool->x[i] >> 8;
+    row[i] = pool->y[i] >> 8;
+  }
+  or_sr(8);			/* enable interrupts (GIE on) */
+
+  for (i = 0; i < PARTICLE_MAX; i++) {
+    u_char oldCol = pool->drawnCol[i], oldRow = pool->drawnRow[i];
+    if (oldCol == PARTICLE_NOT_DRAWN || (live[i] && oldCol == col[i] && oldRow == row[i]))
+      continue;			/* nothing to erase */
+    {
+      Vec2 pixel = {oldCol, oldRow};
+      points[count].col = oldCol;
+      points[count].row = oldRow;
+      points[count++].colorBGR = layerColorAt(layers, &pixel);
+    }
+    pool->drawnCol[i] = PARTICLE_NOT_DRAWN;
+  }
+  for (i = 0; i < PARTICLE_MAX; i++) {
+    if (!live[i])
+      continue;
+    points[count].col = pool->drawnCol[i] = col[i];
+    points[count].row = pool->drawnRow[i] = row[i];
+    points[count++].colorBGR = pool->color[i];
+  }
+  plotPoints(points, count);
+}
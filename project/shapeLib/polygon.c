@@ -0,0 +1,166 @@
+#include "shape.h"
+
+/* abShapeKind's callback for polygons */
+static u_char
+polygonKind(const AbShape *s)
+{
+  return ((const AbPolygon *)s)->check == abPolygonCheck ? SHAPE_KIND_SPANS : SHAPE_KIND_OTHER;
+}
+
+static void __attribute__((constructor))
+polygonRegisterKind()
+{
+  abShapeKindRegister(polygonKind);
+}
+
+static const Vec2 *
+polygonVertices(const AbPolygon *poly)
+{
+  return poly->vertices ? poly->vertices : poly->outline;
+}
+
+// edge from vertex i to the next: rows top..bottom, Q16.16 col at top & slope
+// returns 0 for horizontal edges (their ends are covered by adjacent edges)
+static int
+polygonEdge(const AbPolygon *poly, const Vec2 *centerPos, u_char i,
+	    int *top, int *bottom, long *x, long *slope)
+{
+  const Vec2 *vertices = polygonVertices(poly);
+  const Vec2 *a = &vertices[i], *b = &vertices[(i + 1) % poly->numVertices];
+  if (a->axes[1] == b->axes[1])
+    return 0;
+  if (a->axes[1] > b->axes[1]) {	/* a is always the upper end */
+    const Vec2 *t = a; a = b; b = t;
+  }
+  *top = centerPos->axes[1] + a->axes[1];
+  *bottom = centerPos->axes[1] + b->axes[1];
+  *x = (centerPos->axes[0] + a->axes[0]) * 65536L + 32768L; /* +1/2 rounds */
+  *slope = poly->slopes ? poly->slopes[i] :
+    (b->axes[0] - a->axes[0]) * 65536L / (b->axes[1] - a->axes[1]);
+  return 1;
+}
+
+int
+abPolygonGetSpans(const AbPolygon *poly, const Vec2 *centerPos, int row, Span *spans)
+{
+  u_char i;
+  int top, bottom, col, colMin = 32767, colMax = -32767;
+  long x, slope;
+  for (i = 0; i < poly->numVertices; i++) {
+    if (!polygonEdge(poly, centerPos, i, &top, &bottom, &x, &slope)
+	|| row < top || row > bottom)
+      continue;
+    col = (x + (row - top) * slope) >> 16;
+    if (col < colMin) colMin = col;
+    if (col > colMax) colMax = col;
+  }
+  if (colMin > colMax)
+    return 0;
+  spans[0].colMin = colMin;
+  spans[0].colMax = colMax;
+  return 1;
+}
+
+// true if pixel is within polygon's span of pixel's row
+int
+abPolygonCheck(const AbPolygon *poly, const Vec2 *centerPos, const Vec2 *pixel)
+{
+  Span span;
+  int col = pixel->axes[0];
+  if (pixel->axes[1] < centerPos->axes[1] + poly->extent.topLeft.axes[1] ||
+      pixel->axes[1] > centerPos->axes[1] + poly->extent.botRight.axes[1] ||
+      col < centerPos->axes[0] + poly->extent.topLeft.axes[0] ||
+      col > centerPos->axes[0] + poly->extent.botRight.axes[0])
+    return 0;			/* cheap reject using precomputed extent */
+  if (!abPolygonGetSpans(poly, centerPos, pixel->axes[1], &span))
+    return 0;
+  return col >= span.colMin && col <= span.colMax;
+}
+
+void
+abPolygonGetBounds(const AbPolygon *poly, const Vec2 *centerPos, Region *bounds)
+{
+  vec2Add(&bounds->topLeft, centerPos, &poly->extent.topLeft);
+  vec2Add(&bounds->botRight, centerPos, &poly->extent.botRight);
+  regionClipScreen(bounds);
+}
+
+// extent, and edge slopes if poly has room for them
+static void
+polygonComputeExtent(AbPolygon *poly)
+{
+  const Vec2 *vertices = polygonVertices(poly);
+  u_char i;
+  poly->extent.topLeft = poly->extent.botRight = vertices[0];
+  for (i = 1; i < poly->numVertices; i++) {
+    vec2Min(&poly->extent.topLeft, &poly->extent.topLeft, &vertices[i]);
+    vec2Max(&poly->extent.botRight, &poly->extent.botRight, &vertices[i]);
+  }
+  if (poly->slopes)
+    for (i = 0; i < poly->numVertices; i++) {
+      const Vec2 *a = &vertices[i], *b = &vertices[(i + 1) % poly->numVertices];
+      int rows = b->axes[1] - a->axes[1];
+      poly->slopes[i] = rows ? (b->axes[0] - a->axes[0]) * 65536L / rows : 0;
+    }
+}
+
+void
+abPolygonInit(AbPolygon *poly)
+{
+  u_char i;
+  if (poly->vertices)
+    for (i = 0; i < poly->numVertices; i++)
+      poly->vertices[i] = poly->outline[i];
+  polygonComputeExtent(poly);
+}
+
+void
+abPolygonRotate(AbPolygon *poly, u_char angle)
+{
+  int sin = sinQ8(angle), cos = cosQ8(angle);
+  u_char i;
+  for (i = 0; i < poly->numVertices; i++) {
+    long col = poly->outline[i].axes[0], row = poly->outline[i].axes[1];
+    /* rounded Q8.8 products */
+    poly->vertices[i].axes[0] = (col * cos - row * sin + 128) >> 8;
+    poly->vertices[i].axes[1] = (col * sin + row * cos + 128) >> 8;
+  }
+  polygonComputeExtent(poly);
+}
+
+void
+abPolygonSpanBegin(PolygonSpanWalker *w, const AbPolygon *poly, const Vec2 *centerPos)
+{
+  u_char i, n = 0;
+  w->row = 32767; w->lastRow = -32767;
+  for (i = 0; i < poly->numVertices; i++) {
+    if (!polygonEdge(poly, centerPos, i, &w->top[n], &w->bottom[n], &w->x[n], &w->slope[n]))
+      continue;
+    if (w->top[n] < w->row) w->row = w->top[n];
+    if (w->bottom[n] > w->lastRow) w->lastRow = w->bottom[n];
+    n++;
+  }
+  w->numEdges = n;
+}
+
+int
+abPolygonSpanNext(PolygonSpanWalker *w, int *row, Span *span)
+{
+  u_char i;
+  int col, colMin = 32767, colMax = -32767, r = w->row;
+  if (r > w->lastRow)
+    return 0;
+  for (i = 0; i < w->numEdges; i++) {
+    if (r < w->top[i] || r > w->bottom[i])
+      continue;			/* edge not active in this row */
+    col = w->x[i] >> 16;
+    if (col < colMin) colMin = col;
+    if (col > colMax) colMax = col;
+    w->x[i] += w->slope[i];	/* step to next row */
+  }
+  *row = r;
+  span->colMin = colMin;
+  span->colMax = colMax;
+  w->row = r + 1;
+  return 1;
+}
@@ -1,5 +1,18 @@
 #include "shape.h"
 
+/* abShapeKind's callback for right arrows */
+static u_char
+rarrowKind(const AbShape *s)
+{
+  return ((const AbRArrow *)s)->check == abRArrowCheck ? SHAPE_KIND_RARROW : SHAPE_KIND_OTHER;
+}
+
+static void __attribute__((constructor))
+rarrowRegisterKind()
+{
+  abShapeKindRegister(rarrowKind);
+}
+
 
 /** Check function required by AbShape
  *  abRArrowCheck returns true if the right arrow includes the selected pixel
@@ -1,18 +1,33 @@
 #include "shape.h"
 
+/* abShapeKind's callback for rect.o's shapes */
+static u_char
+rectKind(const AbShape *s)
+{
+  if (((const AbRect *)s)->check == abRectCheck)
+    return SHAPE_KIND_RECT;
+  if (((const AbRect *)s)->check == abRectOutlineCheck)
+    return SHAPE_KIND_RECT_OUTLINE;
+  return SHAPE_KIND_OTHER;
+}
+
+static void __attribute__((constructor))
+rectRegisterKind()
+{
+  abShapeKindRegister(rectKind);
+}
+
 // true if pixel is in rect centerPosed at rectPos
 int 
 abRectCheck(const AbRect *rect, const Vec2 *centerPos, const Vec2 *pixel)
 {
-  Region bounds;
-  abRectGetBounds(rect, centerPos, &bounds);
-  int within = 1, axis;
+  int axis;
   for (axis = 0; axis < 2; axis ++) {
-    int p = pixel->axes[axis];
-    if (p > bounds.botRight.axes[axis] || p < bounds.topLeft.axes[axis])
-      within = 0;
+    int d = pixel->axes[axis] - centerPos->axes[axis];
+    if (d > rect->halfSize.axes[axis] || -d > rect->halfSize.axes[axis])
+      return 0;
   }
-  return within;
+  return 1;
 }
 
 // compute bounding box in screen coordinates for rect at centerPos
@@ -15,3 +15,22 @@ void regionClipScreen(Region *r)
   vec2Min(&r->botRight, &r->botRight, &screenSize);
 }
 
+
+static long
+regionArea(const Region *r)
+{
+  return (long)(r->botRight.axes[0] - r->topLeft.axes[0] + 1) *
+    (r->botRight.axes[1] - r->topLeft.axes[1] + 1);
+}
+
+// grow into to cover r too, unless that adds more than slack pixels
+int
+regionMerge(Region *into, const Region *r, u_int slack)
+{
+  Region merged;
+  regionUnion(&merged, into, r);
+  if (regionArea(&merged) > regionArea(into) + regionArea(r) + slack)
+    return 0;
+  *into = merged;
+  return 1;
+}
@@ -22,3 +22,119 @@ abShapeCheck(const AbShape *s, const Vec2 *centerPos, const Vec2 *pixelLoc)
   return (*s->check)(s, centerPos, pixelLoc);
 }
 
+
+int
+abSpanShapeGetSpans(const AbSpanShape *s, const Vec2 *centerPos, int row, Span *spans)
+{
+  return (*s->getSpans)(s, centerPos, row, spans);
+}
+
+
+/* largest root with root*root <= n (shifts and adds only) */
+static u_int
+isqrt(u_int n)
+{
+  u_int root = 0, bit = 1 << 14;
+  while (bit > n)
+    bit >>= 2;
+  for (; bit; bit >>= 2) {
+    if (n >= root + bit) {
+      n -= root + bit;
+      root = (root >> 1) + bit;
+    } else
+      root >>= 1;
+  }
+  return root;
+}
+
+u_char
+circleOctant(u_char radius)
+{
+  u_int radiusSq = (u_int)radius * radius, row = isqrt(radiusSq >> 1);
+  while ((row + 1) * (2 * row + 1) < radiusSq)
+    row++;
+  while (row && row * (2 * row - 1) >= radiusSq)
+    row--;
+  return row;
+}
+
+int
+circleIncHalfWidth(u_char radius, int rowOffset)
+{
+  u_int radiusSq = (u_int)radius * radius, row, octant, limit, col;
+  row = rowOffset < 0 ? -rowOffset : rowOffset;
+  if (row > radius)
+    return -1;
+  if (!row)
+    return radius;
+  octant = circleOctant(radius);
+  limit = radiusSq - (row - 1) * (row - 1); /* past octant: col*col + col < limit */
+  col = isqrt(limit);
+  if (col * col + col >= limit)
+    col--;
+  if (col > octant)
+    return col;
+  limit = radiusSq - row * row + row; /* within octant: col*col < limit */
+  col = isqrt(limit - 1);
+  return col < octant ? col : octant;
+}
+
+int
+circleIncContains(u_char radius, int colOffset, int rowOffset)
+{
+  u_int radiusSq = (u_int)radius * radius, col, row, colSq;
+  col = colOffset < 0 ? -colOffset : colOffset;
+  row = rowOffset < 0 ? -rowOffset : rowOffset;
+  if (col > radius || row > radius)
+    return 0;
+  if (!row)
+    return 1;
+  colSq = col * col;
+  if (colSq < radiusSq && colSq - col < radiusSq - colSq) /* col <= circleOctant */
+    return colSq < radiusSq - (row * row - row);
+  return colSq + col < radiusSq - (row - 1) * (row - 1);
+}
+
+/* kind callbacks of the shape modules linked in, see abShapeKindRegister */
+static ShapeKindFn kindFns[SHAPE_MAX_KIND_FNS];
+static u_char numKindFns = 0;
+
+void
+abShapeKindRegister(ShapeKindFn kindOf)
+{
+  if (numKindFns < SHAPE_MAX_KIND_FNS)
+    kindFns[numKindFns++] = kindOf;
+}
+
+u_char
+abShapeKind(const AbShape *s)
+{
+  u_char i, kind;
+  for (i = 0; i < numKindFns; i++)
+    if ((kind = kindFns[i](s)) != SHAPE_KIND_OTHER)
+      return kind;
+  return SHAPE_KIND_OTHER;
+}
+
+int
+abShapeGetInterior(const AbShape *s, const Vec2 *centerPos, Region *interior)
+{
+  u_char kind = abShapeKind(s);
+  if (kind == SHAPE_KIND_RECT) {
+    vec2Sub(&interior->topLeft, centerPos, &((const AbRect *)s)->halfSize);
+    vec2Add(&interior->botRight, centerPos, &((const AbRect *)s)->halfSize);
+    return 1;
+  }
+  if (kind == SHAPE_KIND_CIRCLE || kind == SHAPE_KIND_CIRCLE_INC) {
+    int half = (((const AbCircle *)s)->radius * 181 >> 8) - 1; /* inscribed square: radius / sqrt(2), less a pixel */
+    u_char axis;
+    if (half < 0)
+      return 0;
+    for (axis = 0; axis < 2; axis++) {
+      interior->topLeft.axes[axis] = centerPos->axes[axis] - half;
+      interior->botRight.axes[axis] = centerPos->axes[axis] + half;
+    }
+    return 1;
+  }
+  return 0;
+}
@@ -62,6 +62,12 @@ void regionUnion(Region *rUnion, const Region *r1, const Region *r2);
  */
 void regionClipScreen(Region *region);
 
+/** Grow into to the bounding box of into and r, if that box has at most
+ *  slack more pixels than the two regions (see movLayerDrawMerged)
+ *  \return True (1) if merged
+ */
+int regionMerge(Region *into, const Region *r, u_int slack);
+
 /** This function initializes the screen
  *  vectors that are used by shapes
  *
@@ -85,6 +91,30 @@ typedef struct AbShape_s {		/* base type for all abstrct shapes */
   int (*check)(const struct AbShape_s *shape, const Vec2 *centerPos, const Vec2 *pixelLoc);
 } AbShape;
 
+/** A horizontal run of pixels within one row: cols colMin..colMax (inclusive)
+ */
+typedef struct {
+  int colMin, colMax;
+} Span;
+
+/** Upper bound on the number of spans an AbSpanShape reports per row */
+#define SHAPE_MAX_SPANS 4
+
+/** AbShapes that can also report their pixels one row at a time
+ *
+ *  The first two fields are as in AbShape.  The third must be a pointer to
+ *
+ *  getSpans: A function that stores (left to right, non-overlapping) the
+ *  spans of the AbShape within row when rendered at centerPos and returns
+ *  how many there are (at most SHAPE_MAX_SPANS).  Spans are not clipped
+ *  to the screen.  They cover exactly the pixels accepted by check.
+ */
+typedef struct AbSpanShape_s {
+  void (*getBounds)(const struct AbSpanShape_s *shape, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbSpanShape_s *shape, const Vec2 *centerPos, const Vec2 *pixelLoc);
+  int (*getSpans)(const struct AbSpanShape_s *shape, const Vec2 *centerPos, int row, Span *spans);
+} AbSpanShape;
+
 /** Computes bounding box of abShape in screen coordinates 
  *
  *  \param s (in) The abstract shape
@@ -102,6 +132,16 @@ void abShapeGetBounds(const AbShape *s, const Vec2 *centerPos, Region *bounds);
  */
 int abShapeCheck(const AbShape *shape, const Vec2 *centerPos, const Vec2 *pixelLoc);
 
+/** Spans of an AbSpanShape within row (see AbSpanShape)
+ *
+ *  \param shape (in) The abstract shape
+ *  \param centerPos (in) The Vec2 specifying the center position of the shape
+ *  \param row (in) The screen row
+ *  \param spans (out) Array of at least SHAPE_MAX_SPANS spans
+ *  \return Number of spans stored
+ */
+int abSpanShapeGetSpans(const AbSpanShape *shape, const Vec2 *centerPos, int row, Span *spans);
+
 /** An AbShape Right Arrow with filled tip
  *
  *  size: width of the arrow.  Tip is a triangle with width=1/2 size.
@@ -121,6 +161,49 @@ void abRArrowGetBounds(const AbRArrow *arrow, const Vec2 *centerPos, Region *bou
  */
 int abRArrowCheck(const AbRArrow *arrow, const Vec2 *centerPos, const Vec2 *pixel);
 
+/** AbShape circle
+ *  
+ *  chords should be a vector of length radius + 1.  
+ *  Entry at index i is 1/2 chord length at distance i from the circle's center.  
+ *  This vector can be generated using computeChordVec().
+ *
+ *  Incremental mode: circles with chords == 0 and check == abCircleIncCheck
+ *  use no table at all; their extent is computed from midpoint error terms.
+ *  makeCircles emits such circles for radii listed in INC_CIRCLES (Makefile).
+ *
+ *  Declared here so the compositor can draw circles without calling check;
+ *  the functions and tables are in circleLib (abCircle.h).
+ */ 
+typedef struct AbCircle_s {
+  void (*getBounds)(const struct AbCircle_s *circle, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbCircle_s *circle, const Vec2 *centerPos, const Vec2 *pixel);
+  const u_char *chords;
+  const u_char radius;
+} AbCircle;
+
+/** Last row of makeCircles' first octant for radius: the largest row
+ *  with row*(2*row-1) < radius*radius.  Cols up to it are tested as in
+ *  the octant, cols past it as in its mirror image (see circleIncHalfWidth).
+ */
+u_char circleOctant(u_char radius);
+
+/** Half width of a circle's span at rowOffset from its center, or -1 past its top or bottom.
+ *
+ *  Matches makeCircles' (Bresenham) chord tables pixel for pixel without
+ *  a table: col is inside row r > 0 if col*col + r*r - r < radius*radius
+ *  (col <= circleOctant) or col*col + col + (r-1)*(r-1) < radius*radius
+ *  (col past it); row 0 spans -radius..radius.  Costs three integer
+ *  square roots, so callers test rows with it (pixels: circleIncContains).
+ */
+int circleIncHalfWidth(u_char radius, int rowOffset);
+
+/** True if the pixel at (colOffset, rowOffset) from a circle's center is inside it.
+ *
+ *  The same rules as circleIncHalfWidth applied to one pixel: two
+ *  squares and no roots, so per-pixel tests cost the same at any row.
+ */
+int circleIncContains(u_char radius, int colOffset, int rowOffset);
+
 /** AbShape rectangle
  *
  *  Vector halfSize must be to first quadrant (both axes non-negative).  
@@ -150,6 +233,231 @@ void abRectOutlineGetBounds(const AbRect *rect, const Vec2 *centerPos, Region *b
  */
 int abRectOutlineCheck(const AbRect *rect, const Vec2 *centerPos, const Vec2 *pixel);
 
+/** AbShape backed by a Sprite (see lcdutils.h)
+ *
+ *  The sprite is centered at centerPos (its top-left pixel is at 
+ *  centerPos - (width/2, height/2)).  check accepts the sprite's opaque 
+ *  pixels; when drawn as a layer they take the layer's color.  Use 
+ *  abSpriteDraw to draw the sprite's own colors.
+ */
+typedef struct AbSprite_s {
+  void (*getBounds)(const struct AbSprite_s *sprite, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbSprite_s *sprite, const Vec2 *centerPos, const Vec2 *pixel);
+  const Sprite *sprite;
+} AbSprite;
+
+/** As required by AbShape
+ */
+void abSpriteGetBounds(const AbSprite *sprite, const Vec2 *centerPos, Region *bounds);
+
+/** As required by AbShape
+ */
+int abSpriteCheck(const AbSprite *sprite, const Vec2 *centerPos, const Vec2 *pixel);
+
+/** Draw sprite in its own colors at centerPos (using lcd_blit / lcd_blitTransparent)
+ *
+ *  Opaque draws transparent pixels in bgColor; otherwise they are left untouched.
+ *  Sprites that are not entirely on screen are not drawn.
+ */
+void abSpriteDraw(const AbSprite *sprite, const Vec2 *centerPos, int opaque);
+
+/** Fixed-point sine and cosine
+ *
+ *  Angles are in units of 1/256 turn (64 = 90 degrees, clockwise on screen
+ *  since rows grow downward).  Results are Q8.8: 256 represents 1.0.
+ */
+int sinQ8(u_char angle);
+int cosQ8(u_char angle);
+
+/** Most vertices an AbPolygon may have */
+#define POLYGON_MAX_VERTICES 8
+
+/** AbSpanShape convex polygon (a triangle is a 3 vertex polygon)
+ *
+ *  outline: numVertices vertex positions relative to the polygon's center,
+ *  in order around the polygon (either direction).
+ *
+ *  vertices: 0, or numVertices Vec2s of RAM that hold the outline after
+ *  rotation by abPolygonRotate().
+ *
+ *  slopes: 0, or numVertices longs of RAM where abPolygonInit() and
+ *  abPolygonRotate() keep each edge's Q16.16 slope, so finding a row's
+ *  span needs no divides.
+ *
+ *  extent: bounds of the vertices relative to the center.  Computed by
+ *  abPolygonInit() or abPolygonRotate(), one of which must be called
+ *  before the polygon is used.
+ *
+ *  Rows are filled between the polygon's edges, which are stepped in
+ *  Q16.16 fixed point.  Polygons of zero height draw nothing.
+ */
+typedef struct AbPolygon_s {
+  void (*getBounds)(const struct AbPolygon_s *poly, const Vec2 *centerPos, Region *bounds);
+  int (*check)(const struct AbPolygon_s *poly, const Vec2 *centerPos, const Vec2 *pixel);
+  int (*getSpans)(const struct AbPolygon_s *poly, const Vec2 *centerPos, int row, Span *spans);
+  const Vec2 *outline;
+  u_char numVertices;
+  Vec2 *vertices;
+  long *slopes;
+  Region extent;
+} AbPolygon;
+
+/** As required by AbShape
+ */
+void abPolygonGetBounds(const AbPolygon *poly, const Vec2 *centerPos, Region *bounds);
+
+/** As required by AbShape
+ */
+int abPolygonCheck(const AbPolygon *poly, const Vec2 *centerPos, const Vec2 *pixel);
+
+/** As required by AbSpanShape
+ */
+int abPolygonGetSpans(const AbPolygon *poly, const Vec2 *centerPos, int row, Span *spans);
+
+/** Prepare polygon for use (copies outline to vertices if provided, computes extent)
+ */
+void abPolygonInit(AbPolygon *poly);
+
+/** Set polygon's vertices to its outline rotated clockwise by angle (1/256 turns)
+ *  poly->vertices must not be 0.
+ */
+void abPolygonRotate(AbPolygon *poly, u_char angle);
+
+/** Edge table for walking a polygon's spans from top to bottom
+ *
+ *  Each row costs one addition per edge (no multiplies or divides).
+ */
+typedef struct {
+  int top[POLYGON_MAX_VERTICES], bottom[POLYGON_MAX_VERTICES];
+  long x[POLYGON_MAX_VERTICES], slope[POLYGON_MAX_VERTICES]; /* Q16.16 */
+  u_char numEdges;
+  int row, lastRow;
+} PolygonSpanWalker;
+
+/** Prepare walker to emit spans of poly rendered at centerPos, from its top row
+ */
+void abPolygonSpanBegin(PolygonSpanWalker *walker, const AbPolygon *poly, const Vec2 *centerPos);
+
+/** Next row (screen coordinates) of polygon and its span
+ *
+ *  \return 0 once the polygon's bottom row has been passed
+ */
+int abPolygonSpanNext(PolygonSpanWalker *walker, int *row, Span *span);
+
+/** Sides reported by collision queries */
+#define COLLIDE_NONE	0
+#define COLLIDE_LEFT	1
+#define COLLIDE_RIGHT	2
+#define COLLIDE_TOP	3
+#define COLLIDE_BOTTOM	4
+
+/** Describes a collision
+ *
+ *  side: which side of the first shape was hit (COLLIDE_LEFT ... COLLIDE_BOTTOM)
+ *  depth: penetration depth (pixels) perpendicular to that side
+ *  overlap: bounding box of the overlapping pixels 
+ *    (for region queries: the shape's bounds)
+ */
+typedef struct {
+  u_char side;
+  int depth;
+  Region overlap;
+} Contact;
+
+/** Do two abstract shapes overlap when rendered at aPos and bPos?
+ *
+ *  Bounding boxes are compared first.  If they intersect, the shapes' spans
+ *  in each row of the intersection are intersected (rectangles need no
+ *  check); shapes of unknown kind are checked a pixel at a time.
+ *
+ *  \param contact (out) describes the collision (if any); may be 0
+ *  \return True (1) if some pixel is within both shapes
+ */
+int abShapeCollide(const AbShape *a, const Vec2 *aPos, const AbShape *b, const Vec2 *bPos,
+		   Contact *contact);
+
+/** Does abstract shape rendered at aPos extend outside region (e.g. a fence)?
+ *
+ *  \param contact (out) side of the shape beyond the region (the side that 
+ *  extends furthest) and by how much; may be 0
+ *  \return True (1) if shape's bounds are not entirely within region
+ */
+int abShapeRegionCollide(const AbShape *a, const Vec2 *aPos, const Region *region,
+			 Contact *contact);
+
+/** First contact of a moving shape during one step (see abShapeSweep)
+ *
+ *  side: side of the moving shape that makes contact (COLLIDE_LEFT ...)
+ *  time: when, as a Q8 fraction of the step (0..256)
+ *  pos: where the moving shape should stop (touching, not overlapping)
+ */
+typedef struct {
+  u_char side;
+  int time;
+  Vec2 pos;
+} Impact;
+
+/** When does shape a, moving from "from" by velocity in one step, first touch b?
+ *
+ *  The whole motion is tested (bounding boxes are swept), so fast shapes can't
+ *  tunnel through thin ones.  A shape that isn't moving never hits (use
+ *  abShapeCollide for that).  Shapes already overlapping at the start hit at
+ *  time 0 only if a moves deeper along the axis where it overlaps least;
+ *  impact->pos then pushes a out along that axis.  Otherwise they're
+ *  separating and don't hit, so a reflected shape can't bounce in place.
+ *
+ *  \param impact (out) first contact, if any
+ *  \return True (1) if a touches b during the step
+ */
+int abShapeSweep(const AbShape *a, const Vec2 *from, const Vec2 *velocity,
+		 const AbShape *b, const Vec2 *bPos, Impact *impact);
+
+/** When does shape a, moving from "from" by velocity in one step, first leave region?
+ *
+ *  impact->pos keeps a just inside region.
+ *  \return True (1) if a would extend outside region by the end of the step
+ */
+int abShapeSweepRegion(const AbShape *a, const Vec2 *from, const Vec2 *velocity,
+		       const Region *region, Impact *impact);
+
+/** The largest rectangle known to be solid inside a shape (if any)
+ *
+ *  Known for AbRects and, when circleLib is linked, AbCircles.
+ *  Used to skip layers hidden behind others.
+ *  \return True (1) if interior was set
+ */
+int abShapeGetInterior(const AbShape *s, const Vec2 *centerPos, Region *interior);
+
+/** Shape kinds the compositor draws without calling check (see abShapeKind)
+ */
+#define SHAPE_KIND_OTHER 0	/* anything else: use check */
+#define SHAPE_KIND_RECT 1
+#define SHAPE_KIND_RECT_OUTLINE 2
+#define SHAPE_KIND_RARROW 3
+#define SHAPE_KIND_CIRCLE 4	/* chord table */
+#define SHAPE_KIND_CIRCLE_INC 5	/* incremental (no table) */
+#define SHAPE_KIND_SPANS 6	/* AbSpanShape: drawn a row of spans at a time */
+
+/** What kind of shape is s?  Asks the kind callback of each shape
+ *  module linked in (see abShapeKindRegister), so existing shape
+ *  initializers need no tag.
+ */
+u_char abShapeKind(const AbShape *s);
+
+/** A shape module's kind callback: s's kind if s is one of the
+ *  module's shapes, else SHAPE_KIND_OTHER
+ */
+typedef u_char (*ShapeKindFn)(const AbShape *s);
+
+#define SHAPE_MAX_KIND_FNS 6	/* rect, rarrow, polygon and circleLib's circle, ellipse, arc */
+
+/** Tell abShapeKind about a shape module's kinds.
+ *
+ *  Each module with a SHAPE_KIND_ registers from a constructor, so only
+ *  modules a program links are asked and shapeLib's core refers to none.
+ */
+void abShapeKindRegister(ShapeKindFn kindOf);
+
 /** Linked list of Layers.  
  * 
  *  Each layer contains
@@ -157,30 +465,340 @@ int abRectOutlineCheck(const AbRect *rect, const Vec2 *centerPos, const Vec2 *pi
  *   - the layer's current position
  *   - the layer's color
  *   - a reference to the next (lower) layer.
+ *   - flags (optional, LAYER_STATIC ...)
+ *   - its shape's kind and cached bounds at pos
+ *     (maintained by layerInit and movLayerCommit)
  */
 typedef struct Layer_s {
   AbShape *abShape;
   Vec2 pos, posLast, posNext; /* initially just set pos */
   u_int color;
   struct Layer_s *next;
+  u_char flags : 4;
+  u_char kind : 4;		/* SHAPE_KIND_..., set by layerInit */
+  Region bounds;		/* bounds at posLast are recomputed when needed */
 } Layer;	
 
-/** Compute layer's bounding box.
+#define LAYER_STATIC 1		/* never moves: drawn from a StaticLayerCache */
+#define LAYER_BOUNDS_VALID 2	/* bounds is current */
+#define LAYER_MOVED 4		/* pos changed at the last commit */
+
+/** Compute layer's bounding box (covering both pos and posLast).
  */
 void layerGetBounds(const Layer *l, Region *bounds);
 
+/** Layer's bounding box at pos (cached when possible)
+ */
+void layerGetCurrentBounds(const Layer *l, Region *bounds);
+
 /**
   sets bounds into a consistent state
  */
 void layerInit(Layer *layers);
 
+/** Forget a layer's cached bounds.
+ *  Call after changing its shape, or its pos other than via movLayerCommit;
+ *  the shape's kind is looked up again.
+ */
+void layerInvalidate(Layer *l);
+
+/** Do two layers overlap at their next positions (posNext)?  See abShapeCollide.
+ */
+int layerCollide(const Layer *a, const Layer *b, Contact *contact);
+
+/** Does layer extend outside region at its next position?  See abShapeRegionCollide.
+ */
+int layerRegionCollide(const Layer *a, const Region *region, Contact *contact);
+
 /** Render all layers.   
  *  Pixels that are not contained by a layer are set to bgColor.
  */
 void layerDraw(Layer *layers);
 
+/** Render only area of the screen.
+ *  Only layers whose bounding boxes touch area are probed, and layers
+ *  lying wholly behind the solid interior (see abShapeGetInterior) of
+ *  an upper layer are skipped.
+ *  Pixels that are not contained by a layer are set to bgColor.
+ */
+void layerDrawRegion(Layer *layers, const Region *area);
+
+/** A redraw spread over several calls, see layerDrawJobRun
+ */
+typedef struct {
+  Layer *layers;
+  Region area;
+  int row;			/**< next row to draw */
+  u_char rowStep;		/**< 2 if interlaced */
+} LayerDrawJob;
+
+/** Prepare to redraw area a few rows at a time.
+ *
+ *  \param interlaced If nonzero, even rows (counting from area's top) are
+ *  drawn first, then odd ones, so the whole area changes after half the rows
+ */
+void layerDrawJobBegin(LayerDrawJob *job, Layer *layers, const Region *area, u_char interlaced);
+
+/** Draw up to maxRows more rows of a job, with layers at their current positions.
+ *
+ *  Lets the main loop keep its tick rate (and leaves interrupts free to
+ *  run) while a large area is redrawn over several frames.
+ *  \return nonzero while rows remain to be drawn
+ */
+int layerDrawJobRun(LayerDrawJob *job, u_char maxRows);
+
+/** Render all layers at half resolution: see layerDrawRegionLowRes
+ */
+void layerDrawLowRes(Layer *layers);
+
+/** Render area at half resolution, each 2x2 block of pixels taking the
+ *  color of its top-left pixel.
+ *
+ *  A quarter as many pixels are probed as by layerDrawRegion, while the
+ *  LCD still receives one sequential window.  Each block row's colors are
+ *  kept as runs and resent for its second row (rows with too many runs
+ *  are probed again).  area is grown to whole blocks (even top-left).
+ */
+void layerDrawRegionLowRes(Layer *layers, const Region *area);
+
+/** Color of the first layer containing pixel, or bgColor
+ */
+u_int layerColorAt(Layer *layers, const Vec2 *pixel);
+
+/** Pre-rasterized static layers
+ *
+ *  The pixels of a list's LAYER_STATIC layers, stored as runs of identical
+ *  rows, each a list of column spans naming the static layer on top.
+ *  Once built, layerDraw and layerDrawRegion (given the same list) look
+ *  static layers up instead of probing their shapes.
+ */
+#define STATIC_MAX_LAYERS 4
+#define STATIC_MAX_SPANS 24
+#define STATIC_MAX_ROW_RUNS 12
+
+typedef struct {
+  u_char colMin, colMax;	/* inclusive */
+  u_char layer;			/* index into StaticLayerCache.statics */
+} StaticSpan;
+
+typedef struct {
+  u_char rowMax;		/* last row of the run (the first follows the previous run) */
+  u_char firstSpan, numSpans;
+} StaticRowRun;
+
+typedef struct {
+  Layer *layers;		/* the list this cache was built from */
+  Layer *statics[STATIC_MAX_LAYERS];
+  u_char rank[STATIC_MAX_LAYERS]; /* position of each static layer in layers */
+  u_char numRowRuns;
+  StaticRowRun rowRuns[STATIC_MAX_ROW_RUNS];
+  StaticSpan spans[STATIC_MAX_SPANS];
+} StaticLayerCache;
+
+/** Rasterize layers' static layers into cache and use it when drawing layers.
+ *  Call again if a static layer changes.
+ *
+ *  \return True (1) if they fit; otherwise static layers are probed as usual
+ */
+int layerStaticInit(StaticLayerCache *cache, Layer *layers);
+
+/** Q8.8 fixed point: 256 is one pixel */
+#define Q8(px) ((px) * 256)
+
+/** Moving Layer
+ *  Linked list of layer references.
+ *  velocity is Q8.8 pixels per step (one iteration of change);
+ *  frac holds the sub-pixel part of the position (0..255)
+ *  while the layer is drawn at posNext.
+ */
+typedef struct MovLayer_s {
+  Layer *layer;
+  Vec2 velocity;
+  struct MovLayer_s *next;
+  u_char frac[2];		/* by axis */
+} MovLayer;
+
+/** Split one step of a moving layer into whole pixels
+ *
+ *  \param step (out) whole pixels to move this step; the rest stays in ml->frac
+ */
+void mlStep(MovLayer *ml, Vec2 *step);
+
+/** Set a moving layer off at angle (1/256 turns, see sinQ8) and
+ *  speed (Q8.8 pixels per step)
+ */
+void mlLaunch(MovLayer *ml, u_char angle, int speed);
+
+/** Reflect ml's velocity off the side (COLLIDE_LEFT ...) of ml that hit something.
+ *  Only flips if ml is moving into that side, so it can't bounce twice.
+ */
+void mlReflect(MovLayer *ml, u_char side);
+
+/** Advance moving layers by one step, bouncing off the inside of fence
+ */
+void mlAdvance(MovLayer *ml, const Region *fence);
+
+/** Advance moving layers by one step, stopping at the inside of fence
+ */
+void mlAdvanceClamped(MovLayer *ml, const Region *fence);
+
+/** Make posNext current for each moving layer (posLast keeps the old pos).
+ *  Interrupts are disabled meanwhile, so posNext can be updated from a handler.
+ *  Layers that actually moved are flagged LAYER_MOVED and get fresh bounds.
+ */
+void movLayerCommit(MovLayer *movLayers);
+
+/** Commit moving layers, then redraw where each one that moved was and now is
+ *
+ *  \param layers All layers, probed in order
+ */
+void movLayerDraw(MovLayer *movLayers, Layer *layers);
+
+/** movLayerDraw, redrawing nearby layers' areas together.
+ *
+ *  Two layers' areas are drawn as one when the region enclosing both has
+ *  at most slack more pixels than the two areas combined.  Larger slack
+ *  means fewer, larger redraws (see governorMergeSlack).
+ */
+void movLayerDrawMerged(MovLayer *movLayers, Layer *layers, u_int slack);
+
+/** Particles: a fixed pool of moving pixels (sparks, explosions, trails)
+ *
+ *  Stored as parallel arrays.  Positions are unsigned Q8.8 pixels (so
+ *  every row of the screen fits), velocities signed Q8.8 pixels per step;
+ *  life counts down one per step and 0 means the slot is free.  Particles
+ *  are drawn on top of all layers.
+ */
+#ifndef PARTICLE_MAX
+#define PARTICLE_MAX 12
+#endif
+#define PARTICLE_NOT_DRAWN 0xff
+
+typedef struct {
+  u_int x[PARTICLE_MAX], y[PARTICLE_MAX];
+  int vx[PARTICLE_MAX], vy[PARTICLE_MAX];
+  u_char life[PARTICLE_MAX];
+  u_int color[PARTICLE_MAX];
+  u_char drawnCol[PARTICLE_MAX], drawnRow[PARTICLE_MAX]; /* pixel on screen */
+  u_char cap;			/* new particles use only the first cap slots */
+} ParticlePool;
+
+/** Empty pool (cap = PARTICLE_MAX) */
+void particleInit(ParticlePool *pool);
+
+/** Start a particle at pos heading at angle (1/256 turns, see sinQ8)
+ *  with speed (Q8.8 pixels per step), living for life steps
+ *
+ *  \return True (1) unless the pool is full or pos is off screen
+ */
+int particleEmit(ParticlePool *pool, const Vec2 *pos, u_char angle, int speed,
+		 u_char life, u_int color);
+
+/** Emit count particles at pos, spread evenly around the circle
+ */
+void particleBurst(ParticlePool *pool, const Vec2 *pos, u_char count, int speed,
+		   u_char life, u_int color);
+
+/** One physics step: move particles, add gravity (Q8.8) to their
+ *  downward velocity, age them, and free those that die or leave the screen
+ */
+void particleAdvance(ParticlePool *pool, int gravity);
+
+/** Bring the screen up to date: restore what layers show where particles
+ *  were, and draw live ones, all through one batch of plotPoints.
+ *  Call after redrawing layers.
+ */
+void particleDraw(ParticlePool *pool, Layer *layers);
+
+/** Uniform grid over the screen recording which layers touch each cell.
+ *
+ *  A broad phase for drawing and collision: instead of probing every
+ *  layer, ask the grid which layers are near.  Each cell holds a bitset
+ *  of layer indices; index 0 is the first (top) layer in the list.
+ *  Membership is by bounding box at pos, so it is conservative.
+ */
+#define GRID_CELL_SHIFT 4	/* 16x16 pixel cells */
+#define GRID_COLS ((screenWidth + (1 << GRID_CELL_SHIFT) - 1) >> GRID_CELL_SHIFT)
+#define GRID_ROWS ((screenHeight + (1 << GRID_CELL_SHIFT) - 1) >> GRID_CELL_SHIFT)
+#define GRID_MAX_LAYERS 8	/* bits in a GridMask */
+
+typedef u_char GridMask;
+
+typedef struct {
+  Layer *layers[GRID_MAX_LAYERS];
+  u_char numLayers;
+  u_char span[GRID_MAX_LAYERS][4]; /* cells each layer is indexed in: col0, row0, col1, row1 */
+  GridMask cells[GRID_ROWS][GRID_COLS];
+} LayerGrid;
+
+/** Index the first GRID_MAX_LAYERS layers of a list (at their pos)
+ */
+void layerGridInit(LayerGrid *grid, Layer *layers);
+
+/** Re-index layers whose pos moved into different cells.
+ *  Call after pos changes (e.g. where posNext is copied to pos).
+ */
+void layerGridUpdate(LayerGrid *grid);
+
+/** Which layers touch any cell that region touches?
+ */
+GridMask layerGridQuery(const LayerGrid *grid, const Region *region);
+
+/** Which other layers share a cell with layer?  Candidates for layerCollide.
+ */
+GridMask layerGridNeighbors(const LayerGrid *grid, const Layer *layer);
+
+/** Render area like layerDrawRegion, a cell at a time, considering only
+ *  the layers indexed in each cell.  Re-indexes moved layers first.
+ *  Lists longer than GRID_MAX_LAYERS are drawn with layerDrawRegion.
+ */
+void layerGridDraw(LayerGrid *grid, const Region *area);
+
 /** Background color.
   */
 extern u_int bgColor;		/*  background color */
 
+/** Quality governor: steps rendering quality down when frames run over
+ *  budget and back up once they comfortably fit, timed by timerA1Read().
+ *  Quality levels run from QUALITY_MIN (cheapest) to QUALITY_MAX.
+ */
+#define QUALITY_MIN 0
+#define QUALITY_MAX 3
+#define GOVERNOR_DOWN_FRAMES 2	/* frames over budget before stepping down */
+#define GOVERNOR_UP_FRAMES 32	/* frames under 3/4 budget before stepping up */
+
+typedef struct {
+  u_int budget;			/**< target frame time (timerA1Read ticks) */
+  u_int frameStart;
+  u_int average;		/**< smoothed frame time */
+  u_char level;			/**< current quality level */
+  signed char streak;		/**< frames in a row over (<0) or well under (>0) budget */
+  u_char frame;			/**< frame count, for governorHudDue */
+} Governor;
+
+/** Start at QUALITY_MAX.  The caller starts the clock (timerA1Continuous). */
+void governorInit(Governor *governor, u_int budget);
+
+/** Mark the start of a frame's work */
+void governorFrameBegin(Governor *governor);
+
+/** Mark the end of a frame's work and adjust the quality level
+ *  \return the new level
+ */
+u_char governorFrameEnd(Governor *governor);
+
+/** Particle cap for the current level (PARTICLE_MAX at QUALITY_MAX) */
+u_char governorParticleCap(const Governor *governor);
+
+/** Slack for movLayerDrawMerged: 0 at QUALITY_MAX, growing as quality drops */
+u_int governorMergeSlack(const Governor *governor);
+
+/** True if full-screen effects should use layerDrawRegionLowRes */
+int governorLowRes(const Governor *governor);
+
+/** True if the HUD should be redrawn this frame: every frame at
+ *  QUALITY_MAX, every 2nd, 4th or 8th frame at lower levels
+ */
+int governorHudDue(const Governor *governor);
+
 #endif
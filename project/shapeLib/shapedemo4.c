@@ -0,0 +1,54 @@
+#include <libTimer.h>
+#include "lcdutils.h"
+#include "lcddraw.h"
+#include "shape.h"
+
+const Vec2 triangleOutline[] = {{0,-15}, {15,12}, {-15,12}};
+long triangleSlopes[3];
+AbPolygon triangle = {
+  abPolygonGetBounds, abPolygonCheck, abPolygonGetSpans,
+  triangleOutline, 3, 0,	/* never rotated: no vertex RAM */
+  triangleSlopes
+};
+
+const Vec2 pentagonOutline[] = {{0,-20}, {19,-6}, {12,16}, {-12,16}, {-19,-6}};
+Vec2 pentagonVertices[5];	/* pentagon after rotation */
+long pentagonSlopes[5];
+AbPolygon pentagon = {
+  abPolygonGetBounds, abPolygonCheck, abPolygonGetSpans,
+  pentagonOutline, 5, pentagonVertices, pentagonSlopes
+};
+
+Layer layer1 = {
+  (AbShape *)&triangle,
+  {screenWidth/2 - 25, screenHeight/2 - 30}, /* position */
+  {0,0}, {0,0},				    /* last & next pos */
+  COLOR_RED,
+  0,
+};
+Layer layer0 = {
+  (AbShape *)&pentagon,
+  {screenWidth/2 + 10, screenHeight/2 + 20}, /* position */
+  {0,0}, {0,0},				    /* last & next pos */
+  COLOR_ORANGE,
+  &layer1,
+};
+
+u_int bgColor = COLOR_BLUE;
+
+int
+main()
+{
+  configureClocks();
+  lcd_init();
+  shapeInit();
+
+  clearScreen(COLOR_BLUE);
+  drawString5x7(20,20, "polygons", COLOR_GREEN, COLOR_RED);
+
+  abPolygonInit(&triangle);
+  abPolygonRotate(&pentagon, 16); /* 1/16 turn clockwise */
+  
+  layerInit(&layer0);
+  layerDraw(&layer0);
+}
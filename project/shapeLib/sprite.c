@@ -0,0 +1,40 @@
+#include "lcdutils.h"
+#include "shape.h"
+
+// compute bounding box in screen coordinates for sprite at centerPos
+void
+abSpriteGetBounds(const AbSprite *sprite, const Vec2 *centerPos, Region *bounds)
+{
+  const Sprite *s = sprite->sprite;
+  bounds->topLeft.axes[0] = centerPos->axes[0] - s->width / 2;
+  bounds->topLeft.axes[1] = centerPos->axes[1] - s->height / 2;
+  bounds->botRight.axes[0] = bounds->topLeft.axes[0] + s->width - 1;
+  bounds->botRight.axes[1] = bounds->topLeft.axes[1] + s->height - 1;
+}
+
+// true if pixel is an opaque pixel of sprite
+int
+abSpriteCheck(const AbSprite *sprite, const Vec2 *centerPos, const Vec2 *pixel)
+{
+  const Sprite *s = sprite->sprite;
+  u_int color;
+  int col = pixel->axes[0] - (centerPos->axes[0] - s->width / 2);
+  int row = pixel->axes[1] - (centerPos->axes[1] - s->height / 2);
+  if (col < 0 || row < 0 || col >= s->width || row >= s->height)
+    return 0;
+  return spritePixel(s, col, row, &color);
+}
+
+void
+abSpriteDraw(const AbSprite *sprite, const Vec2 *centerPos, int opaque)
+{
+  Region bounds;
+  abSpriteGetBounds(sprite, centerPos, &bounds);
+  if (bounds.topLeft.axes[0] < 0 || bounds.topLeft.axes[1] < 0 ||
+      bounds.botRight.axes[0] >= screenWidth || bounds.botRight.axes[1] >= screenHeight)
+    return;
+  if (opaque)
+    lcd_blit(bounds.topLeft.axes[0], bounds.topLeft.axes[1], sprite->sprite, bgColor);
+  else
+    lcd_blitTransparent(bounds.topLeft.axes[0], bounds.topLeft.axes[1], sprite->sprite);
+}
@@ -0,0 +1,126 @@
+#include "shape.h"
+
+#define NEVER 0x7fffffffL
+
+static u_char
+sideOf(u_char axis, int velocity)
+{
+  if (axis == 0)
+    return velocity > 0 ? COLLIDE_RIGHT : COLLIDE_LEFT;
+  return velocity > 0 ? COLLIDE_BOTTOM : COLLIDE_TOP;
+}
+
+/* a's bounds already overlap b's: push a out of b along the axis of least
+   penetration, but only if velocity drives it deeper along that axis */
+static int
+sweepOverlap(const Region *aBounds, const Region *bBounds, const Vec2 *from,
+	     const Vec2 *velocity, Impact *impact)
+{
+  int push[2];			/* smallest displacement that separates, per axis */
+  u_char axis, pushAxis;
+  for (axis = 0; axis < 2; axis++) {
+    int left = bBounds->topLeft.axes[axis] - 1 - aBounds->botRight.axes[axis]; /* <= 0 */
+    int right = bBounds->botRight.axes[axis] + 1 - aBounds->topLeft.axes[axis]; /* >= 0 */
+    push[axis] = (-left < right) ? left : right;
+  }
+  pushAxis = (push[0] < 0 ? -push[0] : push[0]) <= (push[1] < 0 ? -push[1] : push[1]) ? 0 : 1;
+  if ((long)velocity->axes[pushAxis] * push[pushAxis] >= 0)
+    return 0;			/* separating (or sliding): let it go */
+  impact->time = 0;
+  impact->side = sideOf(pushAxis, velocity->axes[pushAxis]);
+  impact->pos = *from;
+  impact->pos.axes[pushAxis] += push[pushAxis];
+  return 1;
+}
+
+int
+abShapeSweep(const AbShape *a, const Vec2 *from, const Vec2 *velocity,
+	     const AbShape *b, const Vec2 *bPos, Impact *impact)
+{
+  Region aBounds, bBounds;
+  long enterTime = -NEVER, exitTime = NEVER; /* Q8 */
+  u_char axis, hitAxis = 2;
+  abShapeGetBounds(a, from, &aBounds);
+  abShapeGetBounds(b, bPos, &bBounds);
+  if (aBounds.botRight.axes[0] >= bBounds.topLeft.axes[0] &&
+      aBounds.topLeft.axes[0] <= bBounds.botRight.axes[0] &&
+      aBounds.botRight.axes[1] >= bBounds.topLeft.axes[1] &&
+      aBounds.topLeft.axes[1] <= bBounds.botRight.axes[1])
+    return sweepOverlap(&aBounds, &bBounds, from, velocity, impact);
+
+  for (axis = 0; axis < 2; axis++) {
+    int v = velocity->axes[axis];
+    int a0 = aBounds.topLeft.axes[axis], a1 = aBounds.botRight.axes[axis];
+    int b0 = bBounds.topLeft.axes[axis], b1 = bBounds.botRight.axes[axis];
+    long enter, exit;
+    if (v == 0) {		/* must already overlap on this axis */
+      if (a1 < b0 || a0 > b1)
+	return 0;
+      continue;
+    }
+    if (v > 0) {
+      enter = (b0 - a1) * 256L / v;
+      exit = (b1 + 1 - a0) * 256L / v;
+    } else {
+      enter = (b1 - a0) * 256L / v;
+      exit = (b0 - 1 - a1) * 256L / v;
+    }
+    if (enter > enterTime) {
+      enterTime = enter;
+      hitAxis = axis;
+    }
+    if (exit < exitTime)
+      exitTime = exit;
+  }
+  if (hitAxis == 2 || enterTime >= exitTime || enterTime > 256 || exitTime <= 0)
+    return 0;			/* not moving, or no overlap during step */
+
+  impact->time = enterTime;	/* > 0: they didn't overlap at the start */
+  impact->side = sideOf(hitAxis, velocity->axes[hitAxis]);
+  for (axis = 0; axis < 2; axis++)
+    impact->pos.axes[axis] = from->axes[axis] + velocity->axes[axis] * enterTime / 256;
+  {				/* stop adjacent to b */
+    int v = velocity->axes[hitAxis];
+    impact->pos.axes[hitAxis] = from->axes[hitAxis] + ((v > 0)
+      ? bBounds.topLeft.axes[hitAxis] - 1 - aBounds.botRight.axes[hitAxis]
+      : bBounds.botRight.axes[hitAxis] + 1 - aBounds.topLeft.axes[hitAxis]);
+  }
+  return 1;
+}
+
+int
+abShapeSweepRegion(const AbShape *a, const Vec2 *from, const Vec2 *velocity,
+		   const Region *region, Impact *impact)
+{
+  Region bounds;
+  long time, firstTime = NEVER;	/* Q8 */
+  int stop[2];			/* displacement that leaves a touching region */
+  u_char axis, hitAxis = 2;
+  abShapeGetBounds(a, from, &bounds);
+
+  for (axis = 0; axis < 2; axis++) {
+    int v = velocity->axes[axis];
+    if (v > 0 && bounds.botRight.axes[axis] + v > region->botRight.axes[axis])
+      stop[axis] = region->botRight.axes[axis] - bounds.botRight.axes[axis];
+    else if (v < 0 && bounds.topLeft.axes[axis] + v < region->topLeft.axes[axis])
+      stop[axis] = region->topLeft.axes[axis] - bounds.topLeft.axes[axis];
+    else
+      continue;			/* stays within region on this axis */
+    time = stop[axis] * 256L / v;
+    if (time < firstTime) {
+      firstTime = time;
+      hitAxis = axis;
+    }
+  }
+  if (hitAxis == 2)
+    return 0;
+
+  if (firstTime < 0)
+    firstTime = 0;		/* already outside */
+  impact->time = firstTime;
+  impact->side = sideOf(hitAxis, velocity->axes[hitAxis]);
+  for (axis = 0; axis < 2; axis++)
+    impact->pos.axes[axis] = from->axes[axis] + velocity->axes[axis] * firstTime / 256;
+  impact->pos.axes[hitAxis] = from->axes[hitAxis] + stop[hitAxis];
+  return 1;
+}
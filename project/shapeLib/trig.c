@@ -0,0 +1,33 @@
+#include "shape.h"
+
+/* sin of angles 0..64 (first quadrant), Q8.8 */
+static const int quarterSin[65] = {
+  0, 6, 13, 19, 25, 31, 38, 44,
+  50, 56, 62, 68, 74, 80, 86, 92,
+  98, 104, 109, 115, 121, 126, 132, 137,
+  142, 147, 152, 157, 162, 167, 172, 177,
+  181, 185, 190, 194, 198, 202, 206, 209,
+  213, 216, 220, 223, 226, 229, 231, 234,
+  237, 239, 241, 243, 245, 247, 248, 250,
+  251, 252, 253, 254, 255, 255, 256, 256,
+  256,
+};
+
+// sine of angle (1/256 turn units) in Q8.8
+int
+sinQ8(u_char angle)
+{
+  u_char index = angle & 63;
+  int value;
+  if (angle & 64)		/* 2nd & 4th quadrants mirror the 1st */
+    index = 64 - index;
+  value = quarterSin[index];
+  return (angle & 128) ? -value : value;
+}
+
+// cosine of angle (1/256 turn units) in Q8.8
+int
+cosQ8(u_char angle)
+{
+  return sinQ8(angle + 64);
+}
@@ -0,0 +1,11 @@
+#ifndef sprites_included
+#define sprites_included
+
+#include "lcdutils.h"
+
+/** Run-length encoded sprites generated by makeSprites from images/
+ *
+ *  Draw them with lcdLib's lcd_blitRle() or lcd_blitRleTransparent().
+ */
+
+#endif
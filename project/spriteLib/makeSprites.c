@@ -0,0 +1,238 @@
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "ctype.h"
+#include "assert.h"
+
+// Generate run-length encoded sprites (RleSprite, see lcdutils.h) as
+// source files from PBM, PGM and PPM images (ascii or raw).
+//
+// Usage: makeSprites image.ppm ...
+//
+// Each image "dir/name.pXm" becomes sprites/name.c defining
+// "const RleSprite nameSprite".  Declarations are written to sprites_decls.h.
+//
+//  - PBM: black pixels are opaque (white), white pixels are transparent
+//  - PGM: gray levels are reduced to 15 shades; none are transparent
+//  - PPM: magenta (255,0,255) is transparent; at most 15 other colors
+
+#define MAX_COLORS 15		/* palette index 15 means transparent */
+#define TRANSPARENT 15
+
+// skips whitespace and # comments; returns -1 if no number follows
+static int
+nextInt(FILE *fp)
+{
+  int c, value;
+  while ((c = fgetc(fp)) != EOF) {
+    if (c == '#')
+      while ((c = fgetc(fp)) != EOF && c != '\n')
+	;
+    else if (!isspace(c))
+      break;
+  }
+  ungetc(c, fp);
+  if (fscanf(fp, "%d", &value) != 1)
+    return -1;
+  return value;
+}
+
+// returns -1 at end of file
+static int
+nextSample(FILE *fp, int raw, int maxval)
+{
+  if (!raw)
+    return nextInt(fp);
+  if (maxval < 256)
+    return fgetc(fp);
+  {
+    int hi = fgetc(fp), lo = fgetc(fp);
+    return (hi == EOF || lo == EOF) ? -1 : (hi << 8) | lo;
+  }
+}
+
+// 16 bit BGR as used by the LCD (see rgb2bgr in lcdutils.h)
+static unsigned
+bgr(int r, int g, int b)
+{
+  return ((b >> 3) << 11) | ((g >> 2) << 5) | (r >> 3);
+}
+
+static int
+paletteIndex(unsigned *palette, int *numColors, unsigned color, const char *path)
+{
+  int i;
+  for (i = 0; i < *numColors; i++)
+    if (palette[i] == color)
+      return i;
+  if (*numColors == MAX_COLORS) {
+    fprintf(stderr, "makeSprites: %s has more than %d colors\n", path, MAX_COLORS);
+    exit(1);
+  }
+  palette[*numColors] = color;
+  return (*numColors)++;
+}
+
+// reads image, fills indices (width*height) and palette.  returns 0 on failure
+static unsigned char *
+readImage(const char *path, int *width, int *height, unsigned *palette, int *numColors)
+{
+  FILE *fp = fopen(path, "rb");
+  unsigned char *indices;
+  int format, raw, maxval = 1, i, pixels, bad = 0;
+  if (!fp)
+    return 0;
+  if (fgetc(fp) != 'P') {
+    fclose(fp);
+    return 0;
+  }
+  format = fgetc(fp) - '0';
+  raw = format >= 4;
+  *width = nextInt(fp);
+  *height = nextInt(fp);
+  if (format != 1 && format != 4)
+    maxval = nextInt(fp);
+  if (*width <= 0 || *width > 255 || *height <= 0 || *height > 255 ||
+      maxval <= 0 || maxval > 65535) {
+    fprintf(stderr, "makeSprites: %s: bad size or maxval\n", path);
+    fclose(fp);
+    return 0;
+  }
+  if (raw)
+    fgetc(fp);			/* single whitespace before raster */
+  pixels = *width * *height;
+  indices = malloc(pixels);
+  *numColors = 0;
+
+  switch (format) {
+  case 1: case 4:		/* PBM */
+    palette[(*numColors)++] = 0xffff; /* COLOR_WHITE */
+    for (i = 0; i < pixels; i++) {
+      int col = i % *width, bit;
+      if (format == 1) {
+	int c;
+	while ((c = fgetc(fp)) != '0' && c != '1' && c != EOF)
+	  ;
+	bad |= c == EOF;
+	bit = c == '1';
+      } else {
+	static int byte;
+	if (col % 8 == 0)
+	  byte = fgetc(fp);	/* rows are padded to whole bytes */
+	bad |= byte == EOF;
+	bit = (byte >> (7 - col % 8)) & 1;
+      }
+      indices[i] = bit ? 0 : TRANSPARENT;
+    }
+    break;
+  case 2: case 5:		/* PGM */
+    for (i = 0; i < pixels; i++) {
+      int sample = nextSample(fp, raw, maxval);
+      int shade = sample * (MAX_COLORS - 1) / maxval;
+      int gray = shade * 255 / (MAX_COLORS - 1);
+      if (sample < 0 || sample > maxval) {
+	bad = 1;
+	break;
+      }
+      indices[i] = paletteIndex(palette, numColors, bgr(gray, gray, gray), path);
+    }
+    break;
+  case 3: case 6:		/* PPM */
+    for (i = 0; i < pixels; i++) {
+      int r = nextSample(fp, raw, maxval);
+      int g = nextSample(fp, raw, maxval);
+      int b = nextSample(fp, raw, maxval);
+      if (r < 0 || g < 0 || b < 0 || r > maxval || g > maxval || b > maxval) {
+	bad = 1;
+	break;
+      }
+      r = r * 255 / maxval;
+      g = g * 255 / maxval;
+      b = b * 255 / maxval;
+      if (r == 255 && g == 0 && b == 255)
+	indices[i] = TRANSPARENT;
+      else
+	indices[i] = paletteIndex(palette, numColors, bgr(r, g, b), path);
+    }
+    break;
+  default:
+    bad = 1;
+  }
+  fclose(fp);
+  if (bad) {
+    free(indices);
+    return 0;
+  }
+  return indices;
+}
+
+// emits run codes for indices; returns number of bytes
+static int
+writeRuns(FILE *fp, const unsigned char *indices, int pixels)
+{
+  int i = 0, bytes = 0;
+  while (i < pixels) {
+    int index = indices[i], length = 1;
+    while (i + length < pixels && indices[i + length] == index && length < 16 + 255)
+      length++;
+    if (length < 16) {
+      fprintf(fp, "    0x%02x, // %d x %s%d\n", (index << 4) | (length - 1), length,
+	      index == TRANSPARENT ? "transparent " : "color ", index);
+      bytes++;
+    } else {
+      fprintf(fp, "    0x%02x, %d, // %d x %s%d\n", (index << 4) | 15, length - 16, length,
+	      index == TRANSPARENT ? "transparent " : "color ", index);
+      bytes += 2;
+    }
+    i += length;
+  }
+  return bytes;
+}
+
+int main(int argc, char **argv)
+{
+  int arg;
+  FILE *declsFile = fopen("sprites_decls.h", "w");
+  assert(declsFile);
+  fprintf(declsFile, "// Automatically generated by makeSprites.\n");
+  fprintf(declsFile, "#ifndef sprites_decls_included\n#define sprites_decls_included\n\n");
+
+  for (arg = 1; arg < argc; arg++) {
+    char name[100], filename[120];
+    const char *base = strrchr(argv[arg], '/');
+    unsigned palette[MAX_COLORS];
+    int width, height, numColors, i, bytes;
+    unsigned char *indices = readImage(argv[arg], &width, &height, palette, &numColors);
+    if (!indices) {
+      fprintf(stderr, "makeSprites: can't read %s\n", argv[arg]);
+      return 1;
+    }
+    base = base ? base + 1 : argv[arg];
+    for (i = 0; base[i] && base[i] != '.' && i < 99; i++)
+      name[i] = isalnum(base[i]) ? base[i] : '_';
+    name[i] = 0;
+
+    sprintf(filename, "sprites/%s.c", name);
+    FILE *fp = fopen(filename, "w");
+    assert(fp);
+    fprintf(fp, "// Automatically generated by makeSprites from %s\n", argv[arg]);
+    fprintf(fp, "#include \"sprites.h\"\n\n");
+    fprintf(fp, "static const unsigned int %sPalette[%d] = {", name, numColors ? numColors : 1);
+    for (i = 0; i < numColors; i++)
+      fprintf(fp, "%s0x%04x", i ? ", " : "", palette[i]);
+    fprintf(fp, "%s};\n\n", numColors ? "" : "0");
+    fprintf(fp, "static const unsigned char %sRuns[] = {\n", name);
+    bytes = writeRuns(fp, indices, width * height);
+    fprintf(fp, "};\n\n");
+    fprintf(fp, "const RleSprite %sSprite = {%d, %d, %sPalette, %sRuns}; // %d bytes of runs\n",
+	    name, width, height, name, name, bytes);
+    fclose(fp);
+    free(indices);
+
+    fprintf(declsFile, "extern const RleSprite %sSprite; // %dx%d\n", name, width, height);
+  }
+
+  fprintf(declsFile, "\n#endif // included \n");
+  fclose(declsFile);
+  return 0;
+}
@@ -35,4 +35,14 @@ void timerAUpmode()
   TACTL = TASSEL_2 + MC_1;   
 }
 
+// Timer A1 counts continuously at SMCLK/8 (250 kHz), for measuring time.
+// Timer A0 is left to timerAUpmode (the buzzer).
+void timerA1Continuous()
+{
+  TA1CTL = TASSEL_2 + ID_3 + MC_2 + TACLR;
+}
 
+unsigned int timerA1Read()
+{
+  return TA1R;
+}